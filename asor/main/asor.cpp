@@ -5,6 +5,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "esp_netif.h"
 #include "esp_event.h"
 #include "nvs_flash.h"
@@ -14,63 +15,140 @@
 #include "lwip/inet.h"
 #include "mynet.h"  // For net_connect, s_netif
 #include "ui.h"     // For setKnobParam, knob params
-#include "daisysp.h"
-
-#define SAMPLE_RATE 48000
-#define BLOCK_SIZE 96
-#define UDP_PORT 5005
-#define PACKET_SIZE (BLOCK_SIZE * 3)  // 288 bytes for 96 24-bit samples
+#include "audiofmt.h"  // Shared 24-bit BE block packer
+#include "oscbank.h"   // SoA pulse bank (replaces per-sample daisysp loop)
+#include "envbank.h"   // Block-rate amplitude envelopes for the cloud
+#include "paramsmooth.h"
+#include "perfmon.h"
+#include "pitchlut.h"
+#include "routing.h"
+#include "patchsave.h"
+#include "clocksync.h"
+#include "topomgr.h"
+#include "wireproto.h"
+#include "dlog.h"
+#include "wireconfig.h"
+#include "pipeline.h"
+
+// Wire constants come from wireconfig.h; local names kept for the code below
+#define SAMPLE_RATE WIRE_SAMPLE_RATE
+#define BLOCK_SIZE WIRE_BLOCK_SIZE
+#define UDP_PORT WIRE_AUDIO_PORT
+#define PACKET_SIZE WIRE_PACKET_SIZE  // 288 bytes for 96 24-bit samples
 #define PRINT_INTERVAL 500  // Print every 500 packets (~1 second)
 #define NUM_OSCS 10  // 10 pulse oscillators (harp-inspired "cloud")
 #define MAX_TUNE_SPREAD_SEMITONES 2.0f  // Full CW: 2 semitones total spread (±1)
 #define CLOUD_GAIN 0.2f  // Full post-mix gain (increased for volume; monitor for clipping)
+#define PARAM_RAMP_BLOCKS 8  // Knob changes glide over 8 blocks (16ms)
+
+// Known trip counts and a compile-time 1/NUM_OSCS for the mixdown
+using CloudPipe = dms::Pipeline<BLOCK_SIZE, NUM_OSCS>;
+static_assert(CloudPipe::kPacketBytes == PACKET_SIZE, "wire format mismatch");
+
+// Core topology (same names as oscG): synthesis beside the UI on APP,
+// network on PRO with lwIP. asor's sender still calls sendto() itself
+// (BSD path), so only render cycles move off core 0 — the socket handoff
+// to tcpip_thread crosses cores, which lwIP handles anyway.
+#define SYNTH_CORE 1
+#define NET_CORE 0
+
+// Sample-clock sync (slave only — the master election lives in the rack
+// config; asor boxes track whichever module beacons). Empty disables.
+#define CLOCKSYNC_GROUP ""  // e.g. "239.100.0.1"
+
+// Stream topology: the cloud announces itself under this name on the
+// well-known announce group, so receivers can join it by name instead
+// of hardcoding the derived 239.100.x.y address.
+#define TOPO_STREAM_NAME "asor"
 
 #define TAG "ASOR"
 
 void sender_task(void* pvParameters);
 void receiver_task(void* pvParameters);
-// 10 oscillators
-daisysp::Oscillator oscs[NUM_OSCS];
-
-// Global params (registered with setKnobParam for UI updates)
-volatile float raw_base_freq = 440.0f;  // Raw knob value from KNOB1, DMA-updated
-float base_freq = 440.0f;  // KNOB1: Base frequency
-volatile float tune_spread = 0.0f;  // KNOB2: Tuning spread (0.0-1.0)
-volatile float pw_spread = 0.0f;    // KNOB3: PW spread (0.0-1.0)
-//volatile uint8_t knobsUpdated = 0;  // Flag for changes
-
-// Define PACK_L24_BE if not defined elsewhere
-#ifndef PACK_L24_BE
-#define PACK_L24_BE(p, v) do { \
-    (p)[0] = ((v) >> 16) & 0xFF; \
-    (p)[1] = ((v) >> 8) & 0xFF;  \
-    (p)[2] = (v) & 0xFF;         \
-} while (0)
-#endif
+void clocksync_task(void* pvParameters);
+void topo_announce_task(void* pvParameters);
+
+// Clock-sync state: clocksync_task ingests beacons, sender_task jogs
+static clocksync_t g_clocksync;
+// Pulse-voice cloud, batched (capacity dms::OscillatorBank::kMaxVoices = 32)
+dms::OscillatorBank osc_bank;
+// Per-voice amplitude envelopes, segments advanced once per block. The UI
+// task triggers from the button callback; ctlstream gate channels are the
+// planned second source once asor grows a control receiver.
+static dms::EnvelopeBank env_bank;
+
+// Global params (fed from the knobBox seqlock snapshot, one read per block)
+float raw_base_freq = 0.5f;  // Raw knob value from KNOB1
+float base_freq = 440.0f;  // Derived: base frequency
+float tune_spread = 0.0f;  // KNOB2: Tuning spread (0.0-1.0)
+float pw_spread = 0.0f;    // KNOB3: PW spread (0.0-1.0)
+
+static float detune_ratios[NUM_OSCS];        // Cached per-voice ratios from update_cloud_params
+static dms::SmoothedRatio smooth_base_freq;  // Base pitch glides per block instead of stepping
+
+// Patch routing (same engine as oscG): knobs drive named destinations,
+// sender_task reads destinations only.
+static routing_table_t g_routes;
+enum { DST_BASE_PITCH, DST_TUNE_SPREAD, DST_PW_SPREAD };  // Registration order
+
 void exampleButtonCb(uint8_t btn, PressType type) {
     const char* type_str = (type == SHORT_PRESS ? "short" : (type == LONG_PRESS ? "long" : "double"));
     ESP_LOGI(TAG, "Synth: Btn %d %s (e.g., route pot%d to osc freq via patchSave)", btn, type_str, btn);
-    // Future: switch(btn) { case 1: if(type==SHORT_PRESS) set_virtual_route(POT_ADC3, OSC_FREQ); }
+    if (btn == 1 && type == LONG_PRESS) {
+        perfmon_dump();  // Runs in the UI task, off the audio path
+        return;
+    }
+    if (btn == 2 && type == SHORT_PRESS) {
+        // Route editing from a button: swap which knob drives the spread
+        static bool alt_src = false;
+        alt_src = !alt_src;
+        set_virtual_route(&g_routes, alt_src ? KNOB1 : KNOB2, DST_TUNE_SPREAD, 1.0f, 0.0f);
+        patchsave_mark_dirty();
+        ESP_LOGI(TAG, "Route: %s -> knob %d", g_routes.dst_names[DST_TUNE_SPREAD], alt_src ? 1 : 2);
+        return;
+    }
+    if (btn == 3 && type == SHORT_PRESS) {
+        // Strummed retrigger: voice v attacks v*2 blocks (4ms) late
+        env_bank.TriggerAll(2);
+        return;
+    }
+    if (btn == 3 && type == LONG_PRESS) {
+        // Gate toggle: release the cloud to silence, long-press again
+        // to bring it back up
+        static bool gate_on = true;
+        gate_on = !gate_on;
+        env_bank.GateAll(gate_on);
+        ESP_LOGI(TAG, "Envelope gate %s", gate_on ? "on" : "off");
+        return;
+    }
 }
 
 void update_cloud_params() {
-    // Limit raw_base_freq to prevent powf overflow (cast volatile to float)
-    float safe_raw = std::min(0.4f, (float)raw_base_freq);  // Cap at ~3 octaves
-    base_freq = 130.81f * powf(2.0f, safe_raw * 7.0f);  // C3 to ~C9
-
-    // Update oscillators with spread
+    // Limit raw_base_freq to keep the pitch range sane
+    float safe_raw = std::min(0.4f, raw_base_freq);  // Cap at ~3 octaves
+    // C3 up to 84 semitones: octaves by exponent, remainder from the table
+    base_freq = 130.81f * pitchlut_ratio_wide(safe_raw * 84.0f);
+    smooth_base_freq.SetTarget(base_freq);
+
+    // Voice detunes are equally spaced in semitones across the cloud;
+    // each is one interpolated table read, no transcendentals at all.
+    float span = tune_spread * MAX_TUNE_SPREAD_SEMITONES;
+    float step_st = span / (NUM_OSCS - 1.0f);
+    float st = -span * 0.5f;
+    float pw_step = pw_spread * 0.4f / (NUM_OSCS - 1.0f);
+    float pw = 0.5f - pw_spread * 0.2f;
     for (int i = 0; i < NUM_OSCS; ++i) {
-        float detune_ratio = powf(2.0f, ((i - (NUM_OSCS - 1.0f) / 2.0f) / (NUM_OSCS - 1.0f)) * tune_spread * MAX_TUNE_SPREAD_SEMITONES / 12.0f);
-        oscs[i].SetFreq(base_freq * detune_ratio);
-
-        float pw = 0.5f + ((i - (NUM_OSCS - 1.0f) / 2.0f) / (NUM_OSCS - 1.0f)) * pw_spread * 0.4f;
-        oscs[i].SetPw(pw);
+        detune_ratios[i] = pitchlut_ratio(st);  // Applied per block against the smoothed base
+        osc_bank.SetPw(i, pw);
+        st += step_st;
+        pw += pw_step;
     }
 
-    // Debug: Log knob values every 500 packets
+    // Debug: Log knob values every 500 packets (deferred; called per block)
     static int debug_count = 0;
     if (debug_count++ % 500 == 0) {
-        printf("Debug: raw_base_freq: %f, tune_spread: %f, pw_spread: %f\n", raw_base_freq, tune_spread, pw_spread);
+        dlog_write("Debug: raw_base_freq: %f, tune_spread: %f, pw_spread: %f",
+                   raw_base_freq, tune_spread, pw_spread, 0);
     }
 }
 
@@ -82,36 +160,59 @@ extern "C" void app_main(void) {
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+    patchsave_init();  // Patch persistence; regions restore as they register
+    dlog_init(NET_CORE, 1);  // Deferred-log drain, off the synth core
 
     // Initialize network stack
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK(esp_event_loop_create_default());
 
-    // Connect to network
-    ESP_ERROR_CHECK(net_connect());
+    // Start network bring-up and overlap the PHY settle time with the
+    // UI/patch/oscillator init below; the wait is just before the IP is
+    // actually needed.
+    ESP_ERROR_CHECK(net_connect_async());
 
     // Initialize UI and knobs
     initUI();
     setUILogLevel(ESP_LOG_DEBUG);  // Enable debug for testing
     setButtonCallback(exampleButtonCb);
 	
-	setKnobParam(KNOB1, &raw_base_freq);  // Raw knob value
-	setKnobParam(KNOB2, &tune_spread);    // Tuning spread
-	setKnobParam(KNOB3, &pw_spread);      // PW spread
-	base_freq = raw_base_freq;  // Sync initial value
-	knobsUpdated = 1;  // Force initial update
-	
-    // Initialize oscillators
+	setKnobParam(KNOB1, NULL);  // Raw base freq — consumed via knobBox snapshot
+	setKnobParam(KNOB2, NULL);  // Tuning spread
+	setKnobParam(KNOB3, NULL);  // PW spread
+
+    // Default patch: each destination driven by its traditional knob
+    routing_init(&g_routes);
+    routing_register_dest(&g_routes, "base_pitch", 0.5f);   // Order matches the DST_ enum
+    routing_register_dest(&g_routes, "tune_spread", 0.0f);
+    routing_register_dest(&g_routes, "pw_spread", 0.0f);
+    set_virtual_route(&g_routes, KNOB1, DST_BASE_PITCH, 1.0f, 0.0f);
+    set_virtual_route(&g_routes, KNOB2, DST_TUNE_SPREAD, 1.0f, 0.0f);
+    set_virtual_route(&g_routes, KNOB3, DST_PW_SPREAD, 1.0f, 0.0f);
+    // Saved routes (through num_routes; names/values are rebuilt above)
+    // overwrite the defaults before any task reads the table.
+    patchsave_region("routes", &g_routes, offsetof(routing_table_t, dst_values));
+
+    // Initialize oscillator bank
 	base_freq = 440.0f;  // Start at A4
+    osc_bank.Init(SAMPLE_RATE, NUM_OSCS);
+    osc_bank.SetAmp(0.3f);  // Full amp (headroom via post-mix)
+    smooth_base_freq.Init(base_freq, PARAM_RAMP_BLOCKS);
+    // Envelopes idle in sustain at full level, so the untriggered cloud
+    // sounds exactly like the old fixed-amp drone
+    env_bank.Init((float)SAMPLE_RATE / BLOCK_SIZE, NUM_OSCS);
+    env_bank.SetADSR(4.0f, 150.0f, 1.0f, 400.0f);
     for (int i = 0; i < NUM_OSCS; ++i) {
-        oscs[i].Init(SAMPLE_RATE);
-        oscs[i].SetWaveform(daisysp::Oscillator::WAVE_SQUARE);  // Pulse wave for PW control
-        oscs[i].SetAmp(0.3f);  // Full amp (headroom via post-mix)
-		oscs[i].SetFreq(base_freq);  // Ensure oscillation
+        detune_ratios[i] = 1.0f;
+		osc_bank.SetFreq(i, base_freq);  // Ensure oscillation
     }
 
     // Update initial params
     update_cloud_params();
+    clocksync_init(&g_clocksync);
+
+    // Local init is done; now block until the link delivers an address
+    ESP_ERROR_CHECK(net_wait_up(10000));
 
     // Get unicast IP
     esp_netif_ip_info_t ip_info;
@@ -120,20 +221,98 @@ extern "C" void app_main(void) {
     printf("Unicast IP: " IPSTR "\n", IP2STR(&ip_info.ip));
 
     uint8_t* ip_bytes = (uint8_t*)&unicast_ip;
-    uint32_t multicast_ip = (239 << 24) | (100 << 16) | (ip_bytes[2] << 8) | ip_bytes[3];
+    uint32_t multicast_ip = wire_audio_group(ip_bytes[2], ip_bytes[3]);
     printf("Computed multicast address: %lu.%lu.%lu.%lu\n",
            (unsigned long)((multicast_ip >> 24) & 0xFF),
            (unsigned long)((multicast_ip >> 16) & 0xFF),
            (unsigned long)((multicast_ip >> 8) & 0xFF),
            (unsigned long)(multicast_ip & 0xFF));
 
-    // Sender task
-    xTaskCreate(sender_task, "sender_task", 4096, (void*)&multicast_ip, 5, NULL);
+    // Sender task (render + send; render is the expensive half)
+    xTaskCreatePinnedToCore(sender_task, "sender_task", 4096, (void*)&multicast_ip, 5, NULL, SYNTH_CORE);
+
+    // Receiver task (stub for now) lives with the network stack
+    xTaskCreatePinnedToCore(receiver_task, "receiver_task", 4096, (void*)&multicast_ip, 5, NULL, NET_CORE);
+
+    xTaskCreatePinnedToCore(clocksync_task, "clocksync", 3072, NULL, 2, NULL, NET_CORE);
+
+    xTaskCreatePinnedToCore(topo_announce_task, "topo", 3072, (void*)&multicast_ip, 1, NULL, NET_CORE);
+
+    xTaskCreatePinnedToCore(updateUITask, "updateUI", 2048, NULL, 5, NULL, SYNTH_CORE);
+}
+
+// Beacon listener (slave): ingest master sample-clock beacons so the
+// sender can jog its pacing. Idle when no group is configured.
+void clocksync_task(void* pvParameters) {
+    if (CLOCKSYNC_GROUP[0] == '\0') {
+        while (1) vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        printf("ClockSync: Socket creation failed: %s (errno %d)\n", strerror(errno), errno);
+        vTaskDelete(NULL);
+    }
+    struct sockaddr_in bind_addr;
+    memset(&bind_addr, 0, sizeof(bind_addr));
+    bind_addr.sin_family = AF_INET;
+    bind_addr.sin_port = htons(CLOCKSYNC_PORT);
+    bind_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(sock, (struct sockaddr*)&bind_addr, sizeof(bind_addr)) < 0) {
+        printf("ClockSync: Bind failed: %s (errno %d)\n", strerror(errno), errno);
+        close(sock);
+        vTaskDelete(NULL);
+    }
+    struct ip_mreq mreq;
+    mreq.imr_multiaddr.s_addr = inet_addr(CLOCKSYNC_GROUP);
+    mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+    if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+        printf("ClockSync: Join %s failed: %s (errno %d)\n", CLOCKSYNC_GROUP, strerror(errno), errno);
+        close(sock);
+        vTaskDelete(NULL);
+    }
+    printf("ClockSync: Slave listening on %s:%d\n", CLOCKSYNC_GROUP, CLOCKSYNC_PORT);
+
+    uint8_t beacon[sizeof(clocksync_beacon_t)];
+    while (1) {
+        int len = recv(sock, beacon, sizeof(beacon), 0);
+        if (len > 0) {
+            clocksync_ingest(&g_clocksync, beacon, len, esp_timer_get_time());
+        }
+    }
+}
+
+// Announce the cloud's stream once a second on the well-known group so
+// topology-aware receivers (oscG's topo_task) can join it by name. asor
+// has no receive side yet, so it only announces — the lazy-subscribe
+// half arrives with its receiver.
+void topo_announce_task(void* pvParameters) {
+    uint32_t multicast_ip = *(uint32_t*)pvParameters;
+
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        printf("Topo: Socket creation failed: %s (errno %d)\n", strerror(errno), errno);
+        vTaskDelete(NULL);
+    }
+    uint8_t ttl = 1;
+    setsockopt(sock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
 
-    // Receiver task (stub for now)
-    xTaskCreate(receiver_task, "receiver_task", 4096, (void*)&multicast_ip, 5, NULL);
+    struct sockaddr_in dest_addr;
+    memset(&dest_addr, 0, sizeof(dest_addr));
+    dest_addr.sin_family = AF_INET;
+    dest_addr.sin_port = htons(TOPO_PORT);
+    dest_addr.sin_addr.s_addr = inet_addr(TOPO_ANNOUNCE_GROUP);
 
-     xTaskCreatePinnedToCore(updateUITask, "updateUI", 2048, NULL, 5, NULL, 1); // Pin to core 1
+    printf("Topo: Announcing \"%s\" on %s:%d\n", TOPO_STREAM_NAME,
+           TOPO_ANNOUNCE_GROUP, TOPO_PORT);
+    topo_announce_t a;
+    while (1) {
+        topo_write_announce(&a, TOPO_STREAM_NAME, TOPO_TYPE_AUDIO,
+                            htonl(multicast_ip), UDP_PORT,
+                            SAMPLE_RATE / BLOCK_SIZE);
+        sendto(sock, &a, sizeof(a), 0, (struct sockaddr*)&dest_addr, sizeof(dest_addr));
+        vTaskDelay(pdMS_TO_TICKS(TOPO_ANNOUNCE_INTERVAL_MS));
+    }
 }
 
 void sender_task(void* pvParameters) {
@@ -169,48 +348,79 @@ void sender_task(void* pvParameters) {
 
     TickType_t last_wake_time = xTaskGetTickCount();
     int packet_count = 0;
+    uint32_t tx_seq = 0;
 
-    while (1) {
-        uint8_t buffer[PACKET_SIZE];  // 288 bytes
-        int offset = 0;
-		if (knobsUpdated) {
-		    update_cloud_params();
-		    knobsUpdated = 0;
-		}
-		for (int i = 0; i < BLOCK_SIZE; ++i) {  // 96 samples
-		    float mixed_sample = 0.0f;
+    float knobs[PARAMBOX_MAX_PARAMS];
+    uint32_t last_gen = parambox_read(&knobBox, knobs, NUM_KNOBS) - 1;  // Force initial recompute
+    int last_q1 = -1, last_q2 = -1, last_q3 = -1;  // Quantized knob steps
+    uint32_t last_route_gen = g_routes.gen - 1;    // Route edits retrigger the recompute
 
-		    // Mix 10 oscillators (use current params)
-		    for (int j = 0; j < NUM_OSCS; ++j) {
-		        mixed_sample += oscs[j].Process();
+    while (1) {
+        // Header + one block (asor is latency-sensitive, no batching)
+        uint8_t buffer[sizeof(wireproto_hdr_t) + PACKET_SIZE] __attribute__((aligned(4)));
+        float block[BLOCK_SIZE];
+		uint32_t gen = parambox_read(&knobBox, knobs, NUM_KNOBS);
+		uint32_t route_gen = g_routes.gen;
+		if (gen != last_gen || route_gen != last_route_gen) {
+		    last_gen = gen;
+		    last_route_gen = route_gen;
+		    routing_apply(&g_routes, knobs);  // Sources -> destination slots
+		    // Quantized steps gate the recompute: ADC jitter within one
+		    // of 512 steps costs nothing in steady state.
+		    int q1 = pitchlut_quantize(routing_value(&g_routes, DST_BASE_PITCH));
+		    int q2 = pitchlut_quantize(routing_value(&g_routes, DST_TUNE_SPREAD));
+		    int q3 = pitchlut_quantize(routing_value(&g_routes, DST_PW_SPREAD));
+		    if (q1 != last_q1 || q2 != last_q2 || q3 != last_q3) {
+		        last_q1 = q1; last_q2 = q2; last_q3 = q3;
+		        raw_base_freq = pitchlut_step_value(q1);
+		        tune_spread = pitchlut_step_value(q2);
+		        pw_spread = pitchlut_step_value(q3);
+		        update_cloud_params();
 		    }
+		}
+		perfmon_begin(PERF_STAGE_RENDER);
+		// Glide the base pitch one ramp step and retune the cloud: one
+		// multiply per voice, no transcendentals on the block path.
+		float freq_now = smooth_base_freq.NextBlock();
+		for (int i = 0; i < NUM_OSCS; ++i) {
+		    osc_bank.SetFreq(i, freq_now * detune_ratios[i]);
+		}
 
-		    // Clamp with headroom and apply gain
-		    mixed_sample = std::max(-1.0f, std::min(1.0f, mixed_sample / NUM_OSCS)) * CLOUD_GAIN;
+		// Advance envelope segments once per block, then render the
+		// whole bank with the per-sample level ramp folded into the amp
+		float env_a[NUM_OSCS], env_b[NUM_OSCS];
+		env_bank.ProcessBlock(env_a, env_b);
+		osc_bank.RenderBlockEnv(block, BLOCK_SIZE, env_a, env_b);
 
-		    // Debug: Check variation every 500 packets
-		    if (i == 0 && packet_count % 500 == 0) {
-		        printf("Mixed sample at packet %d: %f, base_freq: %f, tune_spread: %f, pw_spread: %f\n",
-		               packet_count, mixed_sample, base_freq, tune_spread, pw_spread);
-		    }
+		// Normalize (reciprocal multiply), clamp with headroom, apply gain
+		CloudPipe::CloudMixdown(block, CLOUD_GAIN);
+		perfmon_end(PERF_STAGE_RENDER);
 
-		    // Pack 24-bit
-		    int32_t value = static_cast<int32_t>(mixed_sample * 8388607.0f);
-		    uint8_t tmp[3];
-		    PACK_L24_BE(tmp, value);
-		    buffer[offset++] = tmp[0];
-		    buffer[offset++] = tmp[1];
-		    buffer[offset++] = tmp[2];
+		// Debug: Check variation every 500 packets (deferred, never blocks)
+		if (packet_count % 500 == 0) {
+		    dlog_write("Mixed sample at packet %.0f: %f, base_freq: %f, tune_spread: %f",
+		               (float)packet_count, block[0], base_freq, tune_spread);
 		}
-        int sent = sendto(sock, buffer, PACKET_SIZE, 0, (struct sockaddr*)&dest_addr, sizeof(dest_addr));
+		perfmon_begin(PERF_STAGE_PACK);
+		// Sample clock of this block, for receiver-side reorder/loss stats
+		uint32_t sample_clock = (uint32_t)((esp_timer_get_time() * (int64_t)SAMPLE_RATE) / 1000000);
+		wireproto_write_hdr((wireproto_hdr_t*)buffer, 1, tx_seq++, sample_clock);
+		audiofmt_pack_l24be(block, BLOCK_SIZE, buffer + sizeof(wireproto_hdr_t));  // Whole block in one pass
+		perfmon_end(PERF_STAGE_PACK);
+        perfmon_begin(PERF_STAGE_SEND);
+        int sent = sendto(sock, buffer, sizeof(buffer), 0, (struct sockaddr*)&dest_addr, sizeof(dest_addr));
+        perfmon_end(PERF_STAGE_SEND);
         if (sent > 0 && (++packet_count % PRINT_INTERVAL == 0)) {
-            printf("Sender: Sent %d bytes (packet #%d)\n", sent, packet_count);
+            dlog_write("Sender: Sent %.0f bytes (packet #%.0f)", (float)sent, (float)packet_count, 0, 0);
         } else if (sent < 0) {
-            printf("Sender: Send failed: %s (errno %d)\n", strerror(errno), errno);
-        } else if (sent != PACKET_SIZE) {
-            printf("Sender: Sent %d bytes, expected %d\n", sent, PACKET_SIZE);
+            dlog_write("Sender: Send failed: errno %.0f", (float)errno, 0, 0, 0);
+        } else if (sent != (int)sizeof(buffer)) {
+            dlog_write("Sender: Sent %.0f bytes, expected %.0f", (float)sent, (float)sizeof(buffer), 0, 0);
         }
 
+        // Clock discipline: ±1 tick jog when this box has drifted a
+        // tick's worth of samples from the master (no-op until beacons)
+        last_wake_time += clocksync_tick_adjust(&g_clocksync, SAMPLE_RATE / 1000);
         vTaskDelayUntil(&last_wake_time, 1);  // 2ms per packet
     }
 
@@ -0,0 +1,128 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+namespace dms {  // Digital Modular Synth namespace
+
+/**
+ * Block-rate amplitude envelope bank for the cloud voices.
+ *
+ * Ten per-sample ADSR envelopes would blow the budget the mix loop
+ * already strains, so segments advance once per 96-sample block and
+ * ProcessBlock hands the render loop a per-voice (start, end) level
+ * pair; OscillatorBank::RenderBlockEnv folds the per-sample linear
+ * interpolation into the amp it was already adding — one extra add per
+ * voice-sample.
+ *
+ * Voices start in sustain at full level, so an untriggered bank sounds
+ * exactly like the old fixed SetAmp drone. TriggerAll staggers attacks
+ * by a block count for the harp-strum gesture.
+ */
+class EnvelopeBank {
+public:
+    static const int kMaxVoices = 32;
+
+    EnvelopeBank() : num_voices_(0), block_rate_(500.0f),
+                     attack_inc_(1.0f), decay_inc_(0.01f),
+                     sustain_(1.0f), release_inc_(0.01f) {}
+
+    void Init(float block_rate, int num_voices) {
+        block_rate_ = block_rate;
+        num_voices_ = (num_voices > kMaxVoices) ? kMaxVoices : num_voices;
+        for (int v = 0; v < kMaxVoices; ++v) {
+            stage_[v] = STAGE_SUSTAIN;  // Drone until something triggers
+            level_[v] = sustain_;
+            delay_blocks_[v] = 0;
+        }
+    }
+
+    // Segment times in ms; sustain is a level (0-1). Applies bank-wide.
+    void SetADSR(float attack_ms, float decay_ms, float sustain, float release_ms) {
+        attack_inc_ = inc_from_ms(attack_ms);
+        decay_inc_ = inc_from_ms(decay_ms);
+        release_inc_ = inc_from_ms(release_ms);
+        sustain_ = sustain;
+    }
+
+    void Trigger(int voice) {
+        if (voice < 0 || voice >= num_voices_) return;
+        stage_[voice] = STAGE_ATTACK;
+        delay_blocks_[voice] = 0;
+    }
+
+    // Strum: voice v starts its attack v*stagger_blocks after the call
+    void TriggerAll(int stagger_blocks) {
+        for (int v = 0; v < num_voices_; ++v) {
+            stage_[v] = STAGE_ATTACK;
+            delay_blocks_[v] = (uint16_t)(v * stagger_blocks);
+        }
+    }
+
+    void GateAll(bool on) {
+        for (int v = 0; v < num_voices_; ++v) {
+            if (on) {
+                if (stage_[v] == STAGE_RELEASE || stage_[v] == STAGE_IDLE) {
+                    stage_[v] = STAGE_ATTACK;
+                }
+            } else {
+                stage_[v] = STAGE_RELEASE;
+            }
+            delay_blocks_[v] = 0;
+        }
+    }
+
+    // Advance every voice one block; start[] gets the level entering the
+    // block, end[] the level leaving it. Linear segments, so the render
+    // loop's per-sample interpolation reproduces them exactly.
+    void ProcessBlock(float* start, float* end) {
+        for (int v = 0; v < num_voices_; ++v) {
+            start[v] = level_[v];
+            if (delay_blocks_[v] > 0) {
+                delay_blocks_[v]--;
+                end[v] = level_[v];
+                continue;
+            }
+            float l = level_[v];
+            switch (stage_[v]) {
+                case STAGE_ATTACK:
+                    l += attack_inc_;
+                    if (l >= 1.0f) { l = 1.0f; stage_[v] = STAGE_DECAY; }
+                    break;
+                case STAGE_DECAY:
+                    l -= decay_inc_;
+                    if (l <= sustain_) { l = sustain_; stage_[v] = STAGE_SUSTAIN; }
+                    break;
+                case STAGE_RELEASE:
+                    l -= release_inc_;
+                    if (l <= 0.0f) { l = 0.0f; stage_[v] = STAGE_IDLE; }
+                    break;
+                case STAGE_SUSTAIN:
+                case STAGE_IDLE:
+                default:
+                    break;
+            }
+            level_[v] = l;
+            end[v] = l;
+        }
+    }
+
+private:
+    enum Stage : uint8_t {
+        STAGE_IDLE, STAGE_ATTACK, STAGE_DECAY, STAGE_SUSTAIN, STAGE_RELEASE
+    };
+
+    float inc_from_ms(float ms) {
+        float blocks = ms * block_rate_ * 0.001f;
+        return (blocks < 1.0f) ? 1.0f : 1.0f / blocks;
+    }
+
+    uint8_t stage_[kMaxVoices];
+    float level_[kMaxVoices];
+    uint16_t delay_blocks_[kMaxVoices];  // Strum stagger countdown
+    int num_voices_;
+    float block_rate_;  // Blocks per second (500 at 48kHz/96)
+    float attack_inc_, decay_inc_;
+    float sustain_, release_inc_;
+};
+
+}  // namespace dms
@@ -0,0 +1,128 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace dms {  // Digital Modular Synth namespace
+
+/**
+ * Batched pulse-oscillator bank for the cloud synth.
+ *
+ * Structure-of-arrays layout (phase / phase_inc / pw in parallel float
+ * arrays) advanced a whole block per voice: each voice pulls its state
+ * into registers once, runs the 96-sample inner loop unrolled by 4, and
+ * writes state back at the end. That keeps the Xtensa pipeline fed
+ * instead of reloading object state 96 times per voice the way the
+ * per-sample daisysp Process() loop did. Sized for 32 voices in roughly
+ * the budget the old 10-voice loop consumed.
+ */
+class OscillatorBank {
+public:
+    static const int kMaxVoices = 32;
+
+    OscillatorBank() : num_voices_(0), amp_(0.3f), sample_rate_(48000.0f) {}
+
+    void Init(float sample_rate, int num_voices) {
+        sample_rate_ = sample_rate;
+        num_voices_ = (num_voices > kMaxVoices) ? kMaxVoices : num_voices;
+        memset(phase_, 0, sizeof(phase_));
+        for (int v = 0; v < kMaxVoices; ++v) {
+            phase_inc_[v] = 440.0f / sample_rate_;
+            pw_[v] = 0.5f;
+        }
+    }
+
+    inline void SetFreq(int voice, float freq) {
+        if (voice < 0 || voice >= num_voices_) return;
+        float inc = freq / sample_rate_;
+        phase_inc_[voice] = (inc < 0.5f) ? inc : 0.5f;  // Clamp at Nyquist
+    }
+
+    inline void SetPw(int voice, float pw) {
+        if (voice < 0 || voice >= num_voices_) return;
+        if (pw < 0.05f) pw = 0.05f;
+        if (pw > 0.95f) pw = 0.95f;
+        pw_[voice] = pw;
+    }
+
+    inline void SetAmp(float amp) { amp_ = amp; }
+    inline int num_voices() const { return num_voices_; }
+
+    // Render the summed bank into out (overwrites, no normalization —
+    // the caller owns gain staging, same as the old mix loop).
+    void RenderBlock(float* out, size_t size) {
+        memset(out, 0, size * sizeof(float));
+        const float amp = amp_;
+        for (int v = 0; v < num_voices_; ++v) {
+            float phase = phase_[v];
+            const float inc = phase_inc_[v];
+            const float pw = pw_[v];
+            size_t i = 0;
+            for (; i + 4 <= size; i += 4) {
+                out[i]     += (phase < pw) ? amp : -amp;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+                out[i + 1] += (phase < pw) ? amp : -amp;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+                out[i + 2] += (phase < pw) ? amp : -amp;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+                out[i + 3] += (phase < pw) ? amp : -amp;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+            }
+            for (; i < size; ++i) {
+                out[i] += (phase < pw) ? amp : -amp;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+            }
+            phase_[v] = phase;
+        }
+    }
+
+    // Envelope variant: each voice's level ramps linearly from
+    // env_start[v] to env_end[v] across the block (the pairs come from
+    // EnvelopeBank's block-rate segments). The ramp folds into the amp
+    // the loop was already adding, so articulation costs one extra add
+    // per voice-sample. Silent voices still advance phase, keeping
+    // retriggers click-free at the waveform's running position.
+    void RenderBlockEnv(float* out, size_t size,
+                        const float* env_start, const float* env_end) {
+        memset(out, 0, size * sizeof(float));
+        const float inv_size = 1.0f / (float)size;
+        for (int v = 0; v < num_voices_; ++v) {
+            float phase = phase_[v];
+            const float inc = phase_inc_[v];
+            const float pw = pw_[v];
+            float amp = amp_ * env_start[v];
+            const float amp_inc = amp_ * (env_end[v] - env_start[v]) * inv_size;
+            size_t i = 0;
+            for (; i + 4 <= size; i += 4) {
+                out[i]     += (phase < pw) ? amp : -amp;
+                amp += amp_inc;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+                out[i + 1] += (phase < pw) ? amp : -amp;
+                amp += amp_inc;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+                out[i + 2] += (phase < pw) ? amp : -amp;
+                amp += amp_inc;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+                out[i + 3] += (phase < pw) ? amp : -amp;
+                amp += amp_inc;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+            }
+            for (; i < size; ++i) {
+                out[i] += (phase < pw) ? amp : -amp;
+                amp += amp_inc;
+                phase += inc; if (phase >= 1.0f) phase -= 1.0f;
+            }
+            phase_[v] = phase;
+        }
+    }
+
+private:
+    float phase_[kMaxVoices];      // SoA voice state, 0..1
+    float phase_inc_[kMaxVoices];  // Per-sample increment
+    float pw_[kMaxVoices];         // Pulse width, 0.05..0.95
+    int num_voices_;
+    float amp_;
+    float sample_rate_;
+};
+
+}  // namespace dms
@@ -0,0 +1,260 @@
+// Offline render + network soak benches for every DSP path the senders
+// run per block. Build instructions in CMakeLists.txt.
+//
+// Timing: on the host this reports ns/sample and throughput; compiled
+// into an ESP-IDF main (the code is guarded on ESP_PLATFORM) the same
+// harness reports CPU cycles/sample from the cycle counter, which is
+// the number the 2ms block budget is spent in.
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+
+#include "oscilator.h"   // dms::Oscillator (sine/square morph, int16 LUT)
+#include "wtosc.h"       // dms::WavetableOscillator (mipmapped tables)
+#include "oscbank.h"     // dms::OscillatorBank (asor's SoA cloud)
+#include "audiofmt.h"    // 24-bit BE pack/unpack
+#include "pitchlut.h"    // Quantized knob-to-ratio mapping
+#include "pipeline.h"    // Compile-time block/voice mix loops
+
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"
+#endif
+
+#define BLOCK_SIZE WIRE_BLOCK_SIZE
+#define NUM_OSCS 10        // asor.cpp cloud size
+#define CLOUD_GAIN 0.2f
+
+#ifdef ESP_PLATFORM
+static inline uint64_t bench_now(void) { return esp_cpu_get_cycle_count(); }
+static const char *kUnit = "cycles";
+static double bench_scale(uint64_t ticks) { return (double)ticks; }
+#else
+static inline uint64_t bench_now(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+static const char *kUnit = "ns";
+static double bench_scale(uint64_t ticks) { return (double)ticks; }
+#endif
+
+// Defeat dead-code elimination without perturbing the loop under test.
+static volatile float g_sink;
+// Read through a volatile so GCC can't constant-fold the block size into
+// inlined render loops (it mis-diagnoses the tail loop as UB otherwise).
+static volatile size_t g_block_size = BLOCK_SIZE;
+static void sink(const float *buf, size_t n) {
+    float s = 0.0f;
+    for (size_t i = 0; i < n; i++) s += buf[i];
+    g_sink = s;
+}
+
+static void report(const char *name, uint64_t ticks, uint64_t samples) {
+    double per = bench_scale(ticks) / (double)samples;
+    double blocks_per_s = 1e9 / (per * BLOCK_SIZE);  // Host ns only
+#ifdef ESP_PLATFORM
+    printf("%-24s %8.2f %s/sample\n", name, per, kUnit);
+    (void)blocks_per_s;
+#else
+    printf("%-24s %8.2f %s/sample  (%.1fk blocks/s)\n", name, per, kUnit,
+           blocks_per_s / 1000.0);
+#endif
+}
+
+// dms::Oscillator::Render — the sine/square morph path
+static void bench_oscillator(uint64_t total_samples) {
+    dms::Oscillator osc;
+    osc.Init(48000);
+    osc.SetFrequency(440.0f);
+    osc.SetShape(0.3f);
+    int16_t block[BLOCK_SIZE];
+    uint64_t t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        osc.Render(block, BLOCK_SIZE);
+    }
+    uint64_t t1 = bench_now();
+    g_sink = (float)block[0];
+    report("oscillator Render", t1 - t0, total_samples);
+}
+
+// dms::WavetableOscillator::RenderBlock — oscG's saw and pulse voices
+static void bench_wtosc(uint64_t total_samples) {
+    dms::WavetableOscillator saw, pulse;
+    saw.Init(48000.0f);
+    saw.SetWaveform(dms::WavetableOscillator::WAVE_SAW);
+    saw.SetFreq(440.0f);
+    pulse.Init(48000.0f);
+    pulse.SetWaveform(dms::WavetableOscillator::WAVE_SQUARE);
+    pulse.SetFreq(441.0f);
+    pulse.SetPw(0.3f);
+    float a[BLOCK_SIZE], b[BLOCK_SIZE], mix[BLOCK_SIZE];
+
+    uint64_t t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        saw.RenderBlock(a, BLOCK_SIZE);
+    }
+    uint64_t t1 = bench_now();
+    report("wtosc saw", t1 - t0, total_samples);
+
+    t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        pulse.RenderBlock(b, BLOCK_SIZE);
+    }
+    t1 = bench_now();
+    report("wtosc pulse", t1 - t0, total_samples);
+
+    // The balance blend as sender_task runs it
+    const float w_saw = 0.6f, w_pulse = 0.4f;
+    t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        for (int i = 0; i < BLOCK_SIZE; i++) {
+            mix[i] = w_saw * a[i] + w_pulse * b[i];
+        }
+    }
+    t1 = bench_now();
+    sink(mix, BLOCK_SIZE);
+    report("balance blend", t1 - t0, total_samples);
+}
+
+// audiofmt 24-bit BE pack/unpack — the wire conversion per block
+static void bench_pack(uint64_t total_samples) {
+    float block[BLOCK_SIZE];
+    uint8_t wire[BLOCK_SIZE * 3] __attribute__((aligned(4)));
+    for (int i = 0; i < BLOCK_SIZE; i++) {
+        block[i] = sinf((float)i * 0.13f) * 0.8f;
+    }
+    uint64_t t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        audiofmt_pack_l24be(block, BLOCK_SIZE, wire);
+    }
+    uint64_t t1 = bench_now();
+    report("pack l24be", t1 - t0, total_samples);
+
+    t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        audiofmt_unpack_l24be(wire, BLOCK_SIZE, block);
+    }
+    t1 = bench_now();
+    sink(block, BLOCK_SIZE);
+    report("unpack l24be", t1 - t0, total_samples);
+}
+
+// The asor 10-voice cloud: retune, RenderBlock, clamp+gain — per block,
+// exactly as sender_task runs it.
+static void bench_cloud(uint64_t total_samples) {
+    dms::OscillatorBank bank;
+    bank.Init(48000.0f, NUM_OSCS);
+    bank.SetAmp(0.3f);
+    float detune[NUM_OSCS];
+    for (int i = 0; i < NUM_OSCS; i++) {
+        detune[i] = pitchlut_ratio(((float)i - (NUM_OSCS - 1) * 0.5f) * 0.2f);
+        bank.SetPw(i, 0.4f + 0.02f * (float)i);
+    }
+    float block[BLOCK_SIZE];
+    float freq = 220.0f;
+    const size_t bs = g_block_size;
+
+    uint64_t t0 = bench_now();
+    for (uint64_t n = 0; n < total_samples; n += BLOCK_SIZE) {
+        for (int i = 0; i < NUM_OSCS; i++) {
+            bank.SetFreq(i, freq * detune[i]);
+        }
+        bank.RenderBlock(block, bs);
+        dms::Pipeline<BLOCK_SIZE, NUM_OSCS>::CloudMixdown(block, CLOUD_GAIN);
+    }
+    uint64_t t1 = bench_now();
+    sink(block, BLOCK_SIZE);
+    report("cloud 10v block", t1 - t0, total_samples);
+}
+
+#ifndef ESP_PLATFORM
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+// Blast fixed-size datagrams at a target rate and report the achieved
+// inter-send jitter — what a receiver's jitter buffer has to absorb
+// before the network adds its own.
+static int soak(const char *dest, int pps, int seconds, int bytes) {
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) { perror("socket"); return 1; }
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(5005);
+    if (inet_pton(AF_INET, dest, &addr.sin_addr) != 1) {
+        fprintf(stderr, "bad address %s\n", dest);
+        return 1;
+    }
+    uint8_t payload[2048];
+    if (bytes < 1 || bytes > (int)sizeof(payload)) bytes = 288;
+    memset(payload, 0x55, sizeof(payload));
+
+    const int64_t interval_ns = 1000000000LL / pps;
+    const int64_t total = (int64_t)pps * seconds;
+    int64_t next = (int64_t)bench_now();
+    int64_t max_late = 0, sum_late = 0, p99_bucket[64] = {0};
+    int64_t sent = 0, errors = 0;
+
+    printf("soak: %d B to %s:5005 at %d pps for %ds\n", bytes, dest, pps, seconds);
+    for (int64_t i = 0; i < total; i++) {
+        while ((int64_t)bench_now() < next) { /* spin: ns-accurate pacing */ }
+        int64_t t = (int64_t)bench_now();
+        if (sendto(sock, payload, (size_t)bytes, 0,
+                   (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+            errors++;
+        }
+        int64_t late = t - next;  // How far behind schedule this send was
+        if (late > max_late) max_late = late;
+        sum_late += late;
+        int b = late <= 0 ? 0 : (63 - __builtin_clzll((uint64_t)late | 1));
+        p99_bucket[b < 64 ? b : 63]++;
+        sent++;
+        next += interval_ns;
+    }
+    // p99 from the log2 histogram
+    int64_t seen = 0, p99 = 0;
+    for (int b = 0; b < 64; b++) {
+        seen += p99_bucket[b];
+        if (seen >= (sent * 99) / 100) { p99 = 1LL << b; break; }
+    }
+    printf("soak: sent %lld (%lld errors), mean late %.1f us, p99 < %.1f us, max %.1f us\n",
+           (long long)sent, (long long)errors,
+           (double)sum_late / (double)sent / 1000.0,
+           (double)p99 / 1000.0, (double)max_late / 1000.0);
+    close(sock);
+    return 0;
+}
+#endif  // !ESP_PLATFORM
+
+int main(int argc, char **argv) {
+    uint64_t millions = 10;
+    if (argc >= 2) {
+#ifndef ESP_PLATFORM
+        if (strcmp(argv[1], "soak") == 0) {
+            if (argc < 4) {
+                fprintf(stderr, "usage: bench soak <dest_ip> <pps> <seconds> [bytes]\n");
+                return 1;
+            }
+            return soak(argv[2], atoi(argv[3]), argc > 4 ? atoi(argv[4]) : 10,
+                        argc > 5 ? atoi(argv[5]) : 288);
+        }
+#endif
+        if (strcmp(argv[1], "quick") == 0) millions = 1;
+        else millions = (uint64_t)atoll(argv[1]);
+        if (millions < 1) millions = 1;
+    }
+    uint64_t total = millions * 1000000ULL;
+    total -= total % BLOCK_SIZE;
+
+    printf("bench: %llu samples per case (48kHz blocks of %d)\n",
+           (unsigned long long)total, BLOCK_SIZE);
+    bench_oscillator(total);
+    bench_wtosc(total);
+    bench_pack(total);
+    bench_cloud(total);
+    return 0;
+}
@@ -11,11 +11,18 @@ import logging
 # Setup logging for debug
 logging.basicConfig(level=logging.INFO, format='%(asctime)s - %(levelname)s - %(message)s')
 
-# Configuration
-UDP_PORT = 5005     # Match main.cpp UDP_PORT
-PACKET_SIZE = 288   # 96 samples * 3 bytes/sample = 288 bytes
-SAMPLE_RATE = 48000 # Match main.cpp SAMPLE_RATE
-BLOCK_SIZE = 96     # Samples per packet
+# Configuration — wire constants must match components/wireconfig/wireconfig.h
+UDP_PORT = 5005     # WIRE_AUDIO_PORT
+PACKET_SIZE = 288   # WIRE_PACKET_SIZE: 96 samples * 3 bytes/sample
+WIRE_MAGIC = 0x444D     # "DM", see components/wireproto/wireproto.h
+WIRE_HDR_V1_SIZE = 8    # <HBBI: magic, version, nblocks, seq
+WIRE_HDR_V2_SIZE = 12   # <HBBII: ... plus 32-bit sample clock
+MAX_DATAGRAM = WIRE_HDR_V2_SIZE + 4 * PACKET_SIZE
+REORDER_WINDOW = 3      # Datagrams a gap may wait before being declared lost
+RESTART_GAP = 500       # Backward seq jump this large means the sender rebooted
+STATS_INTERVAL = 5.0    # Seconds between loss-statistics log lines
+SAMPLE_RATE = 48000 # WIRE_SAMPLE_RATE
+BLOCK_SIZE = 96     # WIRE_BLOCK_SIZE
 CHANNELS = 2        # Stereo
 RECV_TIMEOUT = 0.001  # 1ms for low latency
 
@@ -32,6 +39,82 @@ def unpack_sample(data):
         unsigned_val -= (1 << 24)
     return unsigned_val
 
+def parse_datagram(data):
+    """Return (seq, [288-byte blocks]) for a datagram.
+
+    Accepts legacy bare-block packets (seq is None), wireproto v1
+    (8-byte header) and v2 (12-byte header with sample clock).
+    Returns (None, []) for anything else.
+    """
+    if len(data) == PACKET_SIZE:
+        return None, [data]
+    if len(data) >= WIRE_HDR_V1_SIZE:
+        magic, version, nblocks = struct.unpack_from('<HBB', data, 0)
+        hdr = WIRE_HDR_V1_SIZE if version == 1 else WIRE_HDR_V2_SIZE
+        if (magic == WIRE_MAGIC and version in (1, 2) and
+                1 <= nblocks <= 4 and
+                len(data) == hdr + nblocks * PACKET_SIZE):
+            seq = struct.unpack_from('<I', data, 4)[0]
+            return seq, [data[hdr + i * PACKET_SIZE:hdr + (i + 1) * PACKET_SIZE]
+                         for i in range(nblocks)]
+    return None, []
+
+
+class ReorderBuffer:
+    """Reorders datagrams within a small window and conceals losses.
+
+    Blocks are released strictly in sequence order. A missing datagram is
+    given REORDER_WINDOW later arrivals to show up; if it doesn't, it is
+    counted as lost and concealed by repeating the previous block (only
+    once per gap — a burst of losses decays to silence rather than
+    buzzing on one repeated block).
+    """
+    def __init__(self, window=REORDER_WINDOW):
+        self.window = window
+        self.pending = {}     # seq -> list of blocks
+        self.next_seq = None
+        self.last_block = None
+        self.just_concealed = False
+        self.received = 0
+        self.late = 0
+        self.lost = 0
+
+    def push(self, seq, blocks):
+        """Feed one datagram; return the blocks now ready to play."""
+        self.received += 1
+        if self.next_seq is None:
+            self.next_seq = seq
+        if seq < self.next_seq:
+            if self.next_seq - seq > RESTART_GAP:
+                # Sender rebooted and its seq restarted near zero: re-anchor
+                # on the new numbering instead of counting every packet late
+                # forever and never emitting audio again.
+                self.pending.clear()
+                self.next_seq = seq
+                self.just_concealed = False
+            else:
+                self.late += 1  # Duplicate, or arrived after its slot was concealed
+                return []
+        out = []
+        self.pending[seq] = blocks
+        while self.pending:
+            if self.next_seq in self.pending:
+                for b in self.pending.pop(self.next_seq):
+                    out.append(b)
+                    self.last_block = b
+                self.just_concealed = False
+                self.next_seq += 1
+            elif max(self.pending) - self.next_seq >= self.window:
+                self.lost += 1
+                if self.last_block is not None and not self.just_concealed:
+                    out.append(self.last_block)
+                    self.just_concealed = True
+                self.next_seq += 1
+            else:
+                break  # Gap still within the window; wait for it
+        return out
+
+
 def receiver_thread(multicast_ip, q):
     """Thread to receive from one multicast and queue samples."""
     try:
@@ -47,19 +130,30 @@ def receiver_thread(multicast_ip, q):
         logging.error(f"Socket setup failed for {multicast_ip}: {e}")
         return  # Exit thread on fatal error
 
+    reorder = ReorderBuffer()
+    next_stats = time.monotonic() + STATS_INTERVAL
     while True:
         try:
-            data, _ = sock.recvfrom(PACKET_SIZE)
-            if len(data) == PACKET_SIZE:
-                samples = [unpack_sample(data[i:i+3]) for i in range(0, PACKET_SIZE, 3)]
-                q.put(samples)
-            else:
+            data, _ = sock.recvfrom(MAX_DATAGRAM)
+            seq, blocks = parse_datagram(data)
+            if seq is not None:
+                blocks = reorder.push(seq, blocks)  # In-order, losses concealed
+            if blocks:
+                for block in blocks:
+                    samples = [unpack_sample(block[i:i+3]) for i in range(0, PACKET_SIZE, 3)]
+                    q.put(samples)
+            elif seq is None:
                 q.put([0] * BLOCK_SIZE)  # Zero fill on invalid
         except socket.timeout:
             q.put([0] * BLOCK_SIZE)  # Zero fill on timeout
         except Exception as e:
             logging.warning(f"Receiver error ({multicast_ip}): {e}")
             q.put([0] * BLOCK_SIZE)  # Continue with zeros
+        if time.monotonic() >= next_stats:
+            next_stats += STATS_INTERVAL
+            if reorder.lost or reorder.late:
+                logging.info(f"{multicast_ip}: {reorder.received} rx, "
+                             f"{reorder.lost} lost, {reorder.late} late")
 
 def main():
     args = parse_args()
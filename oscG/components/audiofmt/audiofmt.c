@@ -0,0 +1,56 @@
+#include "audiofmt.h"
+
+static inline uint32_t to_s24(float s) {
+    // Clamp then scale; callers already keep signals in -1..1 but a stray
+    // overshoot must not wrap the 24-bit range.
+    if (s > 1.0f) s = 1.0f;
+    if (s < -1.0f) s = -1.0f;
+    return (uint32_t)(int32_t)(s * 8388607.0f);
+}
+
+static void pack_bytes(const float *samples, size_t n, uint8_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t v = to_s24(samples[i]);
+        out[0] = (v >> 16) & 0xFF;
+        out[1] = (v >> 8) & 0xFF;
+        out[2] = v & 0xFF;
+        out += 3;
+    }
+}
+
+void audiofmt_pack_l24be(const float *samples, size_t n, uint8_t *out) {
+    if (((uintptr_t)out & 3) != 0) {
+        pack_bytes(samples, n, out);  // Xtensa faults on unaligned word stores
+        return;
+    }
+    uint32_t *w = (uint32_t *)out;
+    size_t quads = n / 4;
+    for (size_t i = 0; i < quads; i++) {
+        uint32_t v0 = to_s24(samples[0]);
+        uint32_t v1 = to_s24(samples[1]);
+        uint32_t v2 = to_s24(samples[2]);
+        uint32_t v3 = to_s24(samples[3]);
+        // 4 samples -> 12 wire bytes -> 3 little-endian word stores
+        w[0] = ((v0 >> 16) & 0xFF) | (((v0 >> 8) & 0xFF) << 8) |
+               ((v0 & 0xFF) << 16) | (((v1 >> 16) & 0xFF) << 24);
+        w[1] = ((v1 >> 8) & 0xFF) | ((v1 & 0xFF) << 8) |
+               (((v2 >> 16) & 0xFF) << 16) | (((v2 >> 8) & 0xFF) << 24);
+        w[2] = (v2 & 0xFF) | (((v3 >> 16) & 0xFF) << 8) |
+               (((v3 >> 8) & 0xFF) << 16) | ((v3 & 0xFF) << 24);
+        w += 3;
+        samples += 4;
+    }
+    size_t tail = n & 3;
+    if (tail) {
+        pack_bytes(samples, tail, (uint8_t *)w);
+    }
+}
+
+void audiofmt_unpack_l24be(const uint8_t *in, size_t n, float *samples) {
+    for (size_t i = 0; i < n; i++) {
+        int32_t v = ((int32_t)in[0] << 16) | ((int32_t)in[1] << 8) | in[2];
+        v = (v << 8) >> 8;  // Sign-extend 24 -> 32
+        samples[i] = (float)v * (1.0f / 8388607.0f);
+        in += 3;
+    }
+}
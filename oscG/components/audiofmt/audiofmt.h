@@ -0,0 +1,41 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Pack a block of float samples (-1.0..1.0) to big-endian 24-bit PCM.
+ *
+ * One pass over the block: scale to 24-bit signed and store the wire bytes
+ * word-at-a-time (4 samples -> 3 x 32-bit stores), no per-byte shifts in
+ * the steady state. Write directly into the netbuf/socket payload so the
+ * samples are touched exactly once after synthesis.
+ *
+ * Assumes a little-endian target (ESP32 Xtensa, x86 host). out should be
+ * 4-byte aligned (netbuf/pbuf payloads are); unaligned or tail samples go
+ * through a byte path.
+ *
+ * @param samples Input block of n floats.
+ * @param n Sample count (96 for one audio block).
+ * @param out Destination, n * 3 bytes.
+ */
+void audiofmt_pack_l24be(const float *samples, size_t n, uint8_t *out);
+
+/**
+ * @brief Unpack big-endian 24-bit PCM to float samples (-1.0..1.0).
+ *
+ * Inverse of audiofmt_pack_l24be; used by the receive path to bring a
+ * wire block back into the float mix domain.
+ *
+ * @param in Source, n * 3 bytes.
+ * @param n Sample count.
+ * @param samples Destination block of n floats.
+ */
+void audiofmt_unpack_l24be(const uint8_t *in, size_t n, float *samples);
+
+#ifdef __cplusplus
+}
+#endif
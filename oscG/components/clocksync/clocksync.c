@@ -0,0 +1,77 @@
+#include <string.h>
+#include "clocksync.h"
+
+// Phase error beyond which a one-tick jog is issued, in ticks' worth of
+// samples; a small dead band stops the slave hunting around zero.
+#define CLOCKSYNC_DEADBAND 0.25f
+#define CLOCKSYNC_PPM_ALPHA 0.1f  // EMA weight for the rate estimate
+
+void clocksync_init(clocksync_t *cs) {
+    memset(cs, 0, sizeof(*cs));
+}
+
+int clocksync_ingest(clocksync_t *cs, const uint8_t *data, int len,
+                     int64_t local_us) {
+    if (len != (int)sizeof(clocksync_beacon_t)) return 0;
+    clocksync_beacon_t b;
+    memcpy(&b, data, sizeof(b));  // Datagram buffer may be unaligned
+    if (b.magic != CLOCKSYNC_MAGIC || b.version != CLOCKSYNC_VERSION) return 0;
+
+    if (!cs->have_ref) {
+        cs->last_master = b.sample_clock;
+        cs->last_local_us = local_us;
+        cs->last_seq = b.seq;
+        cs->have_ref = 1;
+        return 1;
+    }
+    // Reordered or duplicate beacon: the phase math only needs monotonic
+    // samples, so just drop it.
+    if ((int32_t)(b.seq - cs->last_seq) <= 0) return 0;
+    cs->last_seq = b.seq;
+
+    // Master advance vs local advance since the PREVIOUS beacon. The
+    // uint32 subtraction is exact across the clock's ~24.8h wrap for a
+    // per-interval delta, and the reference slides forward every beacon,
+    // so no interval ever grows long enough to wrap itself.
+    uint32_t master_delta = b.sample_clock - cs->last_master;
+    double local_delta = (double)(local_us - cs->last_local_us) *
+                         ((double)WIRE_SAMPLE_RATE / 1e6);
+    cs->last_master = b.sample_clock;
+    cs->last_local_us = local_us;
+
+    cs->err_acc += (double)master_delta - local_delta;
+    cs->local_acc += local_delta;
+    // Publish for the render loop; truncation loses under one sample
+    // against a multi-sample dead band. Release pairs with the acquire
+    // load in clocksync_tick_adjust.
+    __atomic_store_n(&cs->err_total, (int32_t)cs->err_acc, __ATOMIC_RELEASE);
+
+    // Rate estimate over the whole accumulated baseline (same long
+    // horizon the fixed reference gave), lightly smoothed.
+    if (cs->local_acc > 0) {
+        float ppm = (float)(cs->err_acc / cs->local_acc * 1e6);
+        cs->ppm += CLOCKSYNC_PPM_ALPHA * (ppm - cs->ppm);
+    }
+    cs->beacons++;
+    return 1;
+}
+
+int clocksync_tick_adjust(clocksync_t *cs, int tick_samples) {
+    if (!cs->have_ref || cs->beacons < 2) return 0;
+    // corr_total is written only here; err_total only by ingest. The
+    // remaining error is their difference, so neither core ever
+    // read-modify-writes a value the other one stores.
+    int32_t err = __atomic_load_n(&cs->err_total, __ATOMIC_ACQUIRE) -
+                  cs->corr_total;
+    float threshold = (1.0f + CLOCKSYNC_DEADBAND) * (float)tick_samples;
+    if ((float)err > threshold) {
+        // Master is ahead: shorten the next wait by one tick
+        cs->corr_total += tick_samples;
+        return -1;
+    }
+    if ((float)err < -threshold) {
+        cs->corr_total -= tick_samples;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <stdint.h>
+#include "wireconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Sample-clock sync beacons across modules.
+ *
+ * Every module paces itself against its own crystal, and two boards
+ * drift apart by tens of ppm — a receiver mixing both streams slips a
+ * buffer every few minutes and glitches. One module (the master)
+ * multicasts a small beacon carrying its sample clock a few times a
+ * second on CLOCKSYNC_PORT; slaves compare the master's clock advance
+ * against their own elapsed time and jog their block pacing by one RTOS
+ * tick whenever the accumulated phase error exceeds a tick's worth of
+ * samples. The jitter buffers absorb the 1ms jog; long-term, every
+ * module tracks the master to within a tick, bounded instead of
+ * unbounded drift.
+ *
+ * Like ctlstream, this header is transport-agnostic (freestanding) —
+ * the beacon send/receive tasks live in the binaries.
+ */
+
+#define CLOCKSYNC_MAGIC 0x4453  // "DS"
+#define CLOCKSYNC_VERSION 1
+#define CLOCKSYNC_PORT 5007
+#define CLOCKSYNC_INTERVAL_MS 250  // Master beacon period
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;        // CLOCKSYNC_MAGIC, little-endian on the wire
+    uint8_t version;       // CLOCKSYNC_VERSION
+    uint8_t reserved;
+    uint32_t seq;          // Beacon sequence, for loss visibility
+    uint32_t sample_clock; // Master sample clock at send (48kHz, wraps ~24.8h)
+} clocksync_beacon_t;
+
+#ifdef __cplusplus
+static_assert(sizeof(clocksync_beacon_t) == 12, "beacon must stay 12 bytes");
+#else
+_Static_assert(sizeof(clocksync_beacon_t) == 12, "beacon must stay 12 bytes");
+#endif
+
+/**
+ * Slave-side discipline state.
+ *
+ * The reference slides forward every beacon: deltas are taken against
+ * the previous beacon (a uint32 subtraction is exact across the clock's
+ * ~24.8h wrap for any sane beacon interval) and accumulated, so nothing
+ * here degrades however long the rack runs.
+ *
+ * Cross-core sharing: clocksync_ingest runs in the NET_CORE listener,
+ * clocksync_tick_adjust in the SYNTH_CORE render loop. Each field has
+ * exactly one writer — ingest owns the accumulators and publishes
+ * err_total with a release store; tick_adjust owns corr_total and reads
+ * err_total with acquire — so neither side read-modify-writes state the
+ * other core stores to (same discipline as parambox and dlog).
+ */
+typedef struct {
+    uint32_t last_master;   // Master clock at the previous beacon
+    int64_t last_local_us;  // Local time at the previous beacon
+    uint32_t last_seq;
+    uint8_t have_ref;
+    float ppm;              // Smoothed rate offset, master vs local
+    double err_acc;         // Accumulated raw drift, samples (ingest only)
+    double local_acc;       // Accumulated local elapsed, samples (ingest only)
+    volatile int32_t err_total;   // err_acc published for tick_adjust
+    volatile int32_t corr_total;  // Samples of jog commanded (tick_adjust only)
+    uint32_t beacons;       // Beacons ingested since init
+} clocksync_t;
+
+/**
+ * @brief Fill in a beacon in-place (master side, one per interval).
+ */
+static inline void clocksync_write_beacon(clocksync_beacon_t *b, uint32_t seq,
+                                          uint32_t sample_clock) {
+    b->magic = CLOCKSYNC_MAGIC;
+    b->version = CLOCKSYNC_VERSION;
+    b->reserved = 0;
+    b->seq = seq;
+    b->sample_clock = sample_clock;
+}
+
+void clocksync_init(clocksync_t *cs);
+
+/**
+ * @brief Feed one received datagram (validated here) with the local
+ *        receive timestamp. Call from the listener task.
+ * @return 1 if the beacon was accepted, 0 otherwise.
+ */
+int clocksync_ingest(clocksync_t *cs, const uint8_t *data, int len,
+                     int64_t local_us);
+
+/**
+ * @brief Ticks to add to the next block wait: +1 when running ahead of
+ *        the master, -1 when behind, 0 in the dead band. Call once per
+ *        block from the render loop; commanded jogs accumulate into
+ *        corr_total, so a correction is applied exactly once.
+ */
+int clocksync_tick_adjust(clocksync_t *cs, int tick_samples);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,67 @@
+#include <string.h>
+#include "ctlstream.h"
+
+size_t ctlstream_pack(uint8_t *out, const float *values, int nchan, uint32_t seq) {
+    if (nchan < 1 || nchan > CTLSTREAM_MAX_CHANNELS) return 0;
+    ctlstream_hdr_t *hdr = (ctlstream_hdr_t *)out;
+    hdr->magic = CTLSTREAM_MAGIC;
+    hdr->version = CTLSTREAM_VERSION;
+    hdr->nchan = (uint8_t)nchan;
+    hdr->seq = seq;
+    memcpy(out + sizeof(*hdr), values, (size_t)nchan * sizeof(float));
+    return ctlstream_bytes(nchan);
+}
+
+void ctlstream_rx_init(ctlstream_rx_t *rx, int interval_blocks) {
+    memset(rx, 0, sizeof(*rx));
+    rx->interval_blocks = (interval_blocks < 1) ? 1 : interval_blocks;
+}
+
+int ctlstream_rx_ingest(ctlstream_rx_t *rx, const uint8_t *data, int len) {
+    int nchan;
+    float values[CTLSTREAM_MAX_CHANNELS];
+
+    if (len == sizeof(float)) {
+        // Bare float from the Python LFO prototype: channel 0
+        nchan = 1;
+        memcpy(values, data, sizeof(float));
+    } else {
+        if (len < (int)sizeof(ctlstream_hdr_t)) return 0;
+        const ctlstream_hdr_t *hdr = (const ctlstream_hdr_t *)data;
+        if (hdr->magic != CTLSTREAM_MAGIC || hdr->version != CTLSTREAM_VERSION) return 0;
+        nchan = hdr->nchan;
+        if (nchan < 1 || nchan > CTLSTREAM_MAX_CHANNELS) return 0;
+        if (len != (int)ctlstream_bytes(nchan)) return 0;
+        memcpy(values, data + sizeof(*hdr), (size_t)nchan * sizeof(float));
+    }
+
+    for (int c = 0; c < nchan; c++) {
+        rx->target[c] = values[c];
+        rx->step[c] = (values[c] - rx->current[c]) / (float)rx->interval_blocks;
+        rx->remaining[c] = (int16_t)rx->interval_blocks;
+    }
+    if (nchan > rx->nchan) rx->nchan = nchan;
+    rx->rx_count++;
+    return nchan;
+}
+
+int ctlstream_rx_step(ctlstream_rx_t *rx, float *out) {
+    int moving = 0;
+    for (int c = 0; c < rx->nchan; c++) {
+        if (rx->remaining[c] > 0) {
+            if (--rx->remaining[c] == 0) {
+                rx->current[c] = rx->target[c];  // Land exactly
+            } else {
+                rx->current[c] += rx->step[c];
+            }
+            moving++;
+        }
+        out[c] = rx->current[c];
+    }
+    // Channels never received stay at 0; expose the full array anyway so
+    // routing sources have stable indices.
+    for (int c = rx->nchan; c < CTLSTREAM_MAX_CHANNELS; c++) {
+        out[c] = 0.0f;
+    }
+    return moving;
+}
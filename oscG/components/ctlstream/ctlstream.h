@@ -0,0 +1,88 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Control-rate streams: one value per 2ms block instead of 48kHz audio.
+ *
+ * An LFO or envelope carried as an audio stream costs 1.15Mbps and a
+ * render budget; as a control stream it is a few floats per block. The
+ * wire format batches many channels per datagram behind an 8-byte
+ * header (own magic, so audio receivers ignore it; sent to
+ * CTLSTREAM_PORT rather than the audio port). The Python prototype's
+ * bare '<f' packets (lfo_module.py) map onto a 1-channel stream.
+ *
+ * Receive side keeps a per-channel linear ramp: each incoming value
+ * becomes a target reached over the expected packet interval, so a
+ * 500Hz stream arrives at the destination block-smooth and can be fed
+ * straight into the routing table's source array.
+ *
+ * Ingest runs in a receiver task while step runs in the sender loop;
+ * floats are word-sized on ESP32 so a race costs at most one block of
+ * a stale value, same trade the knob path makes.
+ */
+#define CTLSTREAM_MAGIC 0x4344  // "DC"
+#define CTLSTREAM_VERSION 1
+#define CTLSTREAM_MAX_CHANNELS 8
+#define CTLSTREAM_PORT 5006
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;    // CTLSTREAM_MAGIC, little-endian on the wire
+    uint8_t version;   // CTLSTREAM_VERSION
+    uint8_t nchan;     // Channel values following this header (1-8)
+    uint32_t seq;      // Datagram sequence number
+} ctlstream_hdr_t;     // Followed by nchan little-endian floats
+
+_Static_assert(sizeof(ctlstream_hdr_t) == 8, "control header must stay 8 bytes");
+
+/**
+ * @brief Datagram size for a channel count.
+ */
+static inline size_t ctlstream_bytes(int nchan) {
+    return sizeof(ctlstream_hdr_t) + (size_t)nchan * sizeof(float);
+}
+
+/**
+ * @brief Pack channel values into a datagram buffer.
+ * @param out Must hold ctlstream_bytes(nchan).
+ * @return Bytes written, or 0 if nchan is out of range.
+ */
+size_t ctlstream_pack(uint8_t *out, const float *values, int nchan, uint32_t seq);
+
+typedef struct {
+    float current[CTLSTREAM_MAX_CHANNELS];
+    float target[CTLSTREAM_MAX_CHANNELS];
+    float step[CTLSTREAM_MAX_CHANNELS];
+    int16_t remaining[CTLSTREAM_MAX_CHANNELS];  // Ramp blocks left per channel
+    int interval_blocks;  // Expected blocks between packets (= ramp length)
+    int nchan;            // Highest channel count seen so far
+    uint32_t rx_count;
+} ctlstream_rx_t;
+
+/**
+ * @brief Reset receive state. interval_blocks is the sender's pacing
+ *        (1 for every block); values glide over that many blocks.
+ */
+void ctlstream_rx_init(ctlstream_rx_t *rx, int interval_blocks);
+
+/**
+ * @brief Feed one received datagram (header validated against len).
+ * @return Channel count, or 0 if this is not a control datagram.
+ */
+int ctlstream_rx_ingest(ctlstream_rx_t *rx, const uint8_t *data, int len);
+
+/**
+ * @brief Advance every ramp one block and write the interpolated values.
+ * @param out Must hold CTLSTREAM_MAX_CHANNELS floats.
+ * @return Number of channels still moving (0 = steady, caller may skip
+ *         downstream recomputation).
+ */
+int ctlstream_rx_step(ctlstream_rx_t *rx, float *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "dlog.h"
+
+#define DLOG_RING_DEPTH 64  // Power of two; ~1.6KB of records
+
+// Multi-producer / single-consumer ring. Producers claim a slot with an
+// atomic increment, fill it, then publish by storing the claim ticket in
+// the slot's seq field (release); the drain task spins past any slot
+// still being filled. No locks, no allocation.
+typedef struct {
+    volatile uint32_t seq;  // claim ticket + 1 once the record is complete
+    uint32_t t_us;          // esp_timer timestamp, truncated (wraps ~71 min)
+    const char *fmt;
+    float args[4];
+} dlog_rec_t;
+
+static dlog_rec_t ring[DLOG_RING_DEPTH];
+static volatile uint32_t head = 0;  // Next claim ticket
+static uint32_t tail = 0;           // Drain task only
+static volatile uint32_t dropped = 0;
+
+void dlog_write(const char *fmt, float a0, float a1, float a2, float a3) {
+    // Full-check is racy across producers, but the worst case is one
+    // extra drop or one record overwritten mid-drain — diagnostics only.
+    if (head - tail >= DLOG_RING_DEPTH) {
+        dropped++;
+        return;
+    }
+    uint32_t ticket = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+    dlog_rec_t *r = &ring[ticket % DLOG_RING_DEPTH];
+    r->t_us = (uint32_t)esp_timer_get_time();
+    r->fmt = fmt;
+    r->args[0] = a0;
+    r->args[1] = a1;
+    r->args[2] = a2;
+    r->args[3] = a3;
+    __atomic_store_n(&r->seq, ticket + 1, __ATOMIC_RELEASE);
+}
+
+static void drain_task(void *pvParameters) {
+    (void)pvParameters;
+    while (1) {
+        uint32_t snapshot = head;
+        while (tail != snapshot) {
+            dlog_rec_t *r = &ring[tail % DLOG_RING_DEPTH];
+            // A producer may have claimed but not finished this slot;
+            // leave it for the next pass rather than spinning.
+            if (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) != tail + 1) break;
+            printf("[%8lu.%03lu] ", (unsigned long)(r->t_us / 1000000),
+                   (unsigned long)((r->t_us / 1000) % 1000));
+            printf(r->fmt, r->args[0], r->args[1], r->args[2], r->args[3]);
+            printf("\n");
+            tail++;
+        }
+        uint32_t d = dropped;
+        if (d) {
+            dropped = 0;
+            printf("dlog: %lu record(s) dropped\n", (unsigned long)d);
+        }
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+}
+
+void dlog_init(int core, int priority) {
+    xTaskCreatePinnedToCore(drain_task, "dlog_drain", 3072, NULL,
+                            priority, NULL, core);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Deferred logging for the audio path.
+ *
+ * The watchdog has been tripped by logging before: a printf/ESP_LOGI to
+ * the UART at 115200 baud can stall the caller for hundreds of
+ * microseconds, which is most of a 2ms block budget. dlog_write instead
+ * copies a fixed-size record (format pointer + four float args) into a
+ * lock-free ring — a few dozen cycles — and a low-priority drain task
+ * on the other core formats and prints it later.
+ *
+ * The format string must be a literal (only the pointer is stored) with
+ * up to four %f/%g conversions; pass counts and indices as floats.
+ * When the ring is full the record is dropped and counted — the audio
+ * tick never waits.
+ */
+
+/**
+ * @brief Start the drain task. Records written before init are kept and
+ *        emitted once it runs.
+ */
+void dlog_init(int core, int priority);
+
+/**
+ * @brief Queue one record. Safe from any task at any priority; callers
+ *        with fewer than four args pass zeros.
+ */
+void dlog_write(const char *fmt, float a0, float a1, float a2, float a3);
+
+#ifdef __cplusplus
+}
+#endif
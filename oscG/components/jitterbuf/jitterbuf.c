@@ -0,0 +1,49 @@
+#include <string.h>
+#include "jitterbuf.h"
+
+void jitterbuf_init(jitterbuf_t *jb, size_t depth) {
+    memset(jb, 0, sizeof(*jb));
+    if (depth < 2) depth = 2;
+    if (depth > JITTERBUF_MAX_DEPTH) depth = JITTERBUF_MAX_DEPTH;
+    jb->depth = depth;
+}
+
+void jitterbuf_push(jitterbuf_t *jb, const uint8_t *block) {
+    uint32_t w = __atomic_load_n(&jb->write_idx, __ATOMIC_RELAXED);
+    uint32_t r = __atomic_load_n(&jb->read_idx, __ATOMIC_ACQUIRE);
+    if (w - r >= jb->depth) {
+        // Full: advance the reader past the oldest block rather than
+        // letting latency grow. The consumer may lose a race here once;
+        // it re-checks occupancy and conceals, which is the right outcome.
+        __atomic_store_n(&jb->read_idx, r + 1, __ATOMIC_RELEASE);
+        jb->overruns++;
+    }
+    memcpy(jb->blocks[w % jb->depth], block, JITTERBUF_BLOCK_BYTES);
+    __atomic_store_n(&jb->write_idx, w + 1, __ATOMIC_RELEASE);
+}
+
+bool jitterbuf_pull(jitterbuf_t *jb, uint8_t *out) {
+    uint32_t r = __atomic_load_n(&jb->read_idx, __ATOMIC_RELAXED);
+    uint32_t w = __atomic_load_n(&jb->write_idx, __ATOMIC_ACQUIRE);
+    if (w == r) {
+        jb->underruns++;
+        if (jb->repeat_armed) {
+            jb->repeat_armed = false;  // Repeat the last good block once
+            memcpy(out, jb->last_good, JITTERBUF_BLOCK_BYTES);
+        } else {
+            memset(out, 0, JITTERBUF_BLOCK_BYTES);  // Then silence
+        }
+        return false;
+    }
+    memcpy(out, jb->blocks[r % jb->depth], JITTERBUF_BLOCK_BYTES);
+    memcpy(jb->last_good, out, JITTERBUF_BLOCK_BYTES);
+    jb->repeat_armed = true;
+    __atomic_store_n(&jb->read_idx, r + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+size_t jitterbuf_level(const jitterbuf_t *jb) {
+    uint32_t w = __atomic_load_n(&jb->write_idx, __ATOMIC_ACQUIRE);
+    uint32_t r = __atomic_load_n(&jb->read_idx, __ATOMIC_ACQUIRE);
+    return (size_t)(w - r);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define JITTERBUF_BLOCK_BYTES 288  // One 96-sample 24-bit block
+#define JITTERBUF_MAX_DEPTH 4      // Hard latency bound: <= 2 blocks target occupancy
+
+/**
+ * @brief Lock-free SPSC jitter buffer of fixed 288-byte audio blocks.
+ *
+ * Producer is the network receiver task, consumer is the render loop.
+ * Writes into a full buffer overwrite the oldest block (bounding latency
+ * instead of growing it); reads from an empty buffer conceal: the last
+ * good block is repeated once, then silence. Indices are free-running
+ * and accessed with atomic builtins, so neither side ever blocks.
+ */
+typedef struct {
+    uint8_t blocks[JITTERBUF_MAX_DEPTH][JITTERBUF_BLOCK_BYTES];
+    uint8_t last_good[JITTERBUF_BLOCK_BYTES];
+    size_t depth;
+    uint32_t write_idx;   // Producer-owned
+    uint32_t read_idx;    // Consumer-owned
+    bool repeat_armed;    // One repeat of last_good allowed per gap
+    uint32_t overruns;    // Blocks overwritten while full
+    uint32_t underruns;   // Pulls that had to conceal
+} jitterbuf_t;
+
+/**
+ * @brief Initialize with the given depth (2..JITTERBUF_MAX_DEPTH).
+ */
+void jitterbuf_init(jitterbuf_t *jb, size_t depth);
+
+/**
+ * @brief Producer: copy one 288-byte block in; overwrites oldest if full.
+ */
+void jitterbuf_push(jitterbuf_t *jb, const uint8_t *block);
+
+/**
+ * @brief Consumer: fill out with the next block.
+ * @return true for a real block, false when it had to conceal
+ *         (repeat of the previous block once, silence after that).
+ */
+bool jitterbuf_pull(jitterbuf_t *jb, uint8_t *out);
+
+/**
+ * @brief Blocks currently buffered (approximate across cores).
+ */
+size_t jitterbuf_level(const jitterbuf_t *jb);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,13 +1,23 @@
 #pragma once
+#include <stdint.h>
+#include <stdbool.h>
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 extern esp_netif_t* s_netif;
 
+// Blocking bring-up: async start + wait, up to 10s
 esp_err_t net_connect(void);
 esp_err_t net_disconnect(void);
 
+// Asynchronous bring-up: returns immediately, the PHY settles on an
+// esp_timer state machine. Poll net_is_up() or block in net_wait_up()
+// (UINT32_MAX waits forever) before touching the network.
+esp_err_t net_connect_async(void);
+bool net_is_up(void);
+esp_err_t net_wait_up(uint32_t timeout_ms);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,7 @@
 #include "lwip/netdb.h"
 #include "lwip/dns.h"
 #include "lwip/ip_addr.h"  // Added for IPSTR and IP2STR
+#include "esp_timer.h"
 #include "mynet.h"
 
 #define ETH_PHY_POWER 12  // Olimex ESP32-POE-ISO power pin
@@ -27,12 +28,27 @@ esp_eth_handle_t s_eth_handle = NULL;  // Made non-static for mynet.h visibility
 esp_netif_t* s_netif;  // Single definition, initialized to NULL by default
 esp_eth_netif_glue_handle_t s_eth_glue = NULL;
 
+// Asynchronous bring-up: the PHY reset/power settling (100+100+1500ms)
+// runs on an esp_timer state machine instead of blocking vTaskDelays, so
+// app_main can initialize the UI, patch restore, and oscillators while
+// the PHY stabilizes. net_is_up() flips when IP_EVENT_ETH_GOT_IP fires.
+typedef enum {
+    NET_PHASE_RESET_HOLD,    // Reset asserted, waiting 100ms
+    NET_PHASE_RESET_SETTLE,  // Reset released, waiting 100ms
+    NET_PHASE_POWER_SETTLE,  // Power on, waiting 1500ms
+} net_phase_t;
+
+static esp_timer_handle_t s_bringup_timer = NULL;
+static net_phase_t s_phase = NET_PHASE_RESET_HOLD;
+static volatile bool s_net_up = false;
+
 static void eth_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
     if (event_base == ETH_EVENT && event_id == ETHERNET_EVENT_CONNECTED) {
         printf("Ethernet Link Up\n");
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_ETH_GOT_IP) {
         ip_event_got_ip_t* event = (ip_event_got_ip_t*)event_data;
         printf("DEBUG: IP Event Received - Ethernet Got IP: " IPSTR "\n", IP2STR(&event->ip_info.ip));
+        s_net_up = true;
         xSemaphoreGive(s_semph_get_ip_addrs);  // Give only when IP is assigned
     }
 }
@@ -52,31 +68,9 @@ static void start(void) {
     }
 }
 
-esp_err_t net_connect(void) {
-    start();
-
-    // Configure and power on PHY with debug
-    gpio_config_t io_conf = {
-        .intr_type = GPIO_INTR_DISABLE,
-        .mode = GPIO_MODE_OUTPUT,
-        .pin_bit_mask = (1ULL << ETH_PHY_POWER) | (1ULL << ETH_PHY_RST_GPIO),
-        .pull_down_en = 0,
-        .pull_up_en = 0
-    };
-    ESP_ERROR_CHECK(gpio_config(&io_conf));
-
-    printf("Applying PHY reset on GPIO%d...\n", ETH_PHY_RST_GPIO);
-    ESP_ERROR_CHECK(gpio_set_level(ETH_PHY_RST_GPIO, 0)); // Active low reset
-    vTaskDelay(100 / portTICK_PERIOD_MS); // Hold reset for 100ms
-    ESP_ERROR_CHECK(gpio_set_level(ETH_PHY_RST_GPIO, 1)); // Release reset
-    printf("PHY reset released.\n");
-    vTaskDelay(100 / portTICK_PERIOD_MS); // Wait after reset
-
-    printf("Powering on PHY on GPIO%d...\n", ETH_PHY_POWER);
-    ESP_ERROR_CHECK(gpio_set_level(ETH_PHY_POWER, 1));
-    vTaskDelay(1500 / portTICK_PERIOD_MS); // Delay for PHY stabilization
-    printf("PHY power delay complete.\n");
-
+// Install the driver and start the EMAC once the PHY has settled. Runs
+// in the esp_timer task on the async path — all plain task context.
+static esp_err_t install_and_start(void) {
     eth_mac_config_t mac_config = ETH_MAC_DEFAULT_CONFIG();
 
     eth_esp32_emac_config_t esp32_emac_config = ETH_ESP32_EMAC_DEFAULT_CONFIG();
@@ -105,13 +99,81 @@ esp_err_t net_connect(void) {
     ESP_ERROR_CHECK(esp_netif_attach(s_netif, s_eth_glue));
 
     ESP_ERROR_CHECK(esp_eth_start(s_eth_handle));
+    return ESP_OK;
+}
 
-    printf("Waiting for IP assignment...\n");
-    if (xSemaphoreTake(s_semph_get_ip_addrs, pdMS_TO_TICKS(10000)) != pdTRUE) {
+static void bringup_timer_cb(void* arg) {
+    (void)arg;
+    switch (s_phase) {
+        case NET_PHASE_RESET_HOLD:
+            ESP_ERROR_CHECK(gpio_set_level(ETH_PHY_RST_GPIO, 1)); // Release reset
+            printf("PHY reset released.\n");
+            s_phase = NET_PHASE_RESET_SETTLE;
+            ESP_ERROR_CHECK(esp_timer_start_once(s_bringup_timer, 100 * 1000));
+            break;
+        case NET_PHASE_RESET_SETTLE:
+            printf("Powering on PHY on GPIO%d...\n", ETH_PHY_POWER);
+            ESP_ERROR_CHECK(gpio_set_level(ETH_PHY_POWER, 1));
+            s_phase = NET_PHASE_POWER_SETTLE;
+            ESP_ERROR_CHECK(esp_timer_start_once(s_bringup_timer, 1500 * 1000));
+            break;
+        case NET_PHASE_POWER_SETTLE:
+            printf("PHY power delay complete.\n");
+            if (install_and_start() != ESP_OK) {
+                printf("Ethernet driver start failed\n");
+            }
+            break;
+    }
+}
+
+esp_err_t net_connect_async(void) {
+    start();
+
+    // Configure and assert PHY reset; the timer walks the settle phases
+    gpio_config_t io_conf = {
+        .intr_type = GPIO_INTR_DISABLE,
+        .mode = GPIO_MODE_OUTPUT,
+        .pin_bit_mask = (1ULL << ETH_PHY_POWER) | (1ULL << ETH_PHY_RST_GPIO),
+        .pull_down_en = 0,
+        .pull_up_en = 0
+    };
+    ESP_ERROR_CHECK(gpio_config(&io_conf));
+
+    printf("Applying PHY reset on GPIO%d...\n", ETH_PHY_RST_GPIO);
+    ESP_ERROR_CHECK(gpio_set_level(ETH_PHY_RST_GPIO, 0)); // Active low reset
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = bringup_timer_cb,
+        .name = "net_bringup",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_bringup_timer));
+    s_phase = NET_PHASE_RESET_HOLD;
+    ESP_ERROR_CHECK(esp_timer_start_once(s_bringup_timer, 100 * 1000));
+    return ESP_OK;
+}
+
+bool net_is_up(void) {
+    return s_net_up;
+}
+
+esp_err_t net_wait_up(uint32_t timeout_ms) {
+    if (s_net_up) return ESP_OK;
+    TickType_t ticks = (timeout_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTake(s_semph_get_ip_addrs, ticks) != pdTRUE) {
         printf("IP assignment timeout\n");
         return ESP_FAIL;
     }
+    xSemaphoreGive(s_semph_get_ip_addrs);  // Stay signalled for other waiters
+    return ESP_OK;
+}
 
+esp_err_t net_connect(void) {
+    // Blocking path, same behavior as before the async split
+    esp_err_t err = net_connect_async();
+    if (err != ESP_OK) return err;
+    printf("Waiting for IP assignment...\n");
+    err = net_wait_up(10000);
+    if (err != ESP_OK) return err;
     printf("Ethernet connected with IP assigned, s_netif: %p\n", (void*)s_netif);
     return ESP_OK;
 }
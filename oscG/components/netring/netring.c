@@ -0,0 +1,52 @@
+#include <string.h>
+#include "esp_log.h"
+#include "netring.h"
+
+static const char *TAG = "NETRING";
+
+esp_err_t netring_init(netring_t *ring, size_t depth, size_t payload_size) {
+    if (ring == NULL || depth < 2 || depth > NETRING_MAX_DEPTH || payload_size == 0) {
+        ESP_LOGE(TAG, "Bad ring config (depth %u)", (unsigned)depth);
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->depth = depth;
+    ring->payload_size = payload_size;
+    for (size_t i = 0; i < depth; i++) {
+        ring->bufs[i] = netbuf_new();
+        if (ring->bufs[i] == NULL) {
+            ESP_LOGE(TAG, "netbuf_new failed at slot %u", (unsigned)i);
+            netring_free(ring);
+            return ESP_ERR_NO_MEM;
+        }
+        ring->payloads[i] = (uint8_t *)netbuf_alloc(ring->bufs[i], payload_size);
+        if (ring->payloads[i] == NULL) {
+            ESP_LOGE(TAG, "netbuf_alloc(%u) failed at slot %u", (unsigned)payload_size, (unsigned)i);
+            netring_free(ring);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    ESP_LOGI(TAG, "Ring ready: %u x %u bytes", (unsigned)depth, (unsigned)payload_size);
+    return ESP_OK;
+}
+
+struct netbuf *netring_next(netring_t *ring, uint8_t **payload) {
+    size_t slot = ring->next;
+    ring->next = (slot + 1) % ring->depth;
+    if (payload) {
+        *payload = ring->payloads[slot];
+    }
+    return ring->bufs[slot];
+}
+
+void netring_free(netring_t *ring) {
+    for (size_t i = 0; i < ring->depth; i++) {
+        if (ring->bufs[i]) {
+            netbuf_delete(ring->bufs[i]);  // Frees the payload pbuf too
+            ring->bufs[i] = NULL;
+            ring->payloads[i] = NULL;
+        }
+    }
+    ring->depth = 0;
+    ring->next = 0;
+}
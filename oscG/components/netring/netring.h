@@ -0,0 +1,50 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "lwip/api.h"
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NETRING_MAX_DEPTH 8  // Upper bound on preallocated netbufs per ring
+
+/**
+ * @brief Fixed ring of preallocated netbufs for the audio send hot path.
+ *
+ * All netbuf_new()/netbuf_alloc() happens once in netring_init(); the 2ms
+ * render loop just cycles through the slots and never touches the allocator.
+ * Depth must exceed the number of buffers lwIP can still hold in flight
+ * (EMAC DMA keeps a pbuf ref briefly after netconn_sendto returns), so use
+ * at least 2, typically 4.
+ */
+typedef struct {
+    struct netbuf *bufs[NETRING_MAX_DEPTH];
+    uint8_t *payloads[NETRING_MAX_DEPTH];
+    size_t depth;
+    size_t payload_size;
+    size_t next;
+} netring_t;
+
+/**
+ * @brief Preallocate depth netbufs of payload_size bytes each.
+ * @return ESP_OK, or ESP_ERR_NO_MEM if the pool is exhausted (ring is freed).
+ */
+esp_err_t netring_init(netring_t *ring, size_t depth, size_t payload_size);
+
+/**
+ * @brief Get the next buffer in rotation (never blocks, never fails after init).
+ * @param payload Set to the writable payload area of the returned netbuf.
+ * @return The netbuf to pass to netconn_sendto(); do NOT netbuf_delete() it.
+ */
+struct netbuf *netring_next(netring_t *ring, uint8_t **payload);
+
+/**
+ * @brief Release all netbufs (only safe once no sends are in flight).
+ */
+void netring_free(netring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+#include <string.h>
+#include "parambox.h"
+
+void parambox_publish(parambox_t *box, const float *values, size_t n) {
+    if (n > PARAMBOX_MAX_PARAMS) n = PARAMBOX_MAX_PARAMS;
+    // Odd seq marks the snapshot as in-flux; release ordering makes the
+    // value stores visible before the closing (even) increment.
+    __atomic_fetch_add(&box->seq, 1, __ATOMIC_ACQ_REL);
+    memcpy(box->values, values, n * sizeof(float));
+    __atomic_fetch_add(&box->seq, 1, __ATOMIC_RELEASE);
+}
+
+uint32_t parambox_read(const parambox_t *box, float *out, size_t n) {
+    if (n > PARAMBOX_MAX_PARAMS) n = PARAMBOX_MAX_PARAMS;
+    uint32_t s1, s2;
+    do {
+        s1 = __atomic_load_n(&box->seq, __ATOMIC_ACQUIRE);
+        if (s1 & 1) continue;  // Writer inside, retry (writer is fast)
+        memcpy(out, box->values, n * sizeof(float));
+        s2 = __atomic_load_n(&box->seq, __ATOMIC_ACQUIRE);
+    } while (s1 != s2 || (s1 & 1));
+    return s1 >> 1;  // Generation = completed publishes
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PARAMBOX_MAX_PARAMS 16  // Matches NUM_KNOBS in ui.h
+
+/**
+ * @brief Single-producer single-consumer parameter mailbox (seqlock).
+ *
+ * The UI task on core 1 publishes a full snapshot of knob-derived values;
+ * an audio sender on core 0 reads one consistent snapshot per block. This
+ * replaces the pile of bare volatile floats, which had no memory-ordering
+ * guarantees between cores and could hand the audio path a torn mix of
+ * old and new values.
+ *
+ * seq is even when the snapshot is stable, odd while the writer is inside
+ * it. Writes and reads use GCC atomic builtins for ordering; neither side
+ * ever blocks or takes a lock.
+ */
+typedef struct {
+    float values[PARAMBOX_MAX_PARAMS];
+    uint32_t seq;
+} parambox_t;
+
+/**
+ * @brief Publish a new snapshot (producer side only).
+ * @param box The mailbox.
+ * @param values Source array of n floats.
+ * @param n Value count (<= PARAMBOX_MAX_PARAMS).
+ */
+void parambox_publish(parambox_t *box, const float *values, size_t n);
+
+/**
+ * @brief Read a consistent snapshot (consumer side only, never blocks).
+ * @param box The mailbox.
+ * @param out Destination array of n floats.
+ * @param n Value count (<= PARAMBOX_MAX_PARAMS).
+ * @return Generation number; unchanged generation means unchanged values,
+ *         so callers can skip recomputation by comparing to the last one.
+ */
+uint32_t parambox_read(const parambox_t *box, float *out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,90 @@
+#pragma once
+#include <math.h>
+
+namespace dms {  // Digital Modular Synth namespace
+
+/**
+ * Per-block parameter smoothing.
+ *
+ * Knob updates used to hit the audio loop as step changes plus inline
+ * powf() calls, spiking the block that happened to see knobsUpdated.
+ * These ramps convert a new target into a fixed number of per-block
+ * steps, so a control change costs one add (or one multiply for pitch)
+ * per block on the hot path and glides instead of zipping.
+ */
+
+// Linear ramp: for balance, pulse width, gains.
+class SmoothedParam {
+public:
+    SmoothedParam() : value_(0.0f), target_(0.0f), step_(0.0f), remaining_(0), ramp_blocks_(1) {}
+
+    void Init(float initial, int ramp_blocks) {
+        value_ = target_ = initial;
+        step_ = 0.0f;
+        remaining_ = 0;
+        ramp_blocks_ = (ramp_blocks < 1) ? 1 : ramp_blocks;
+    }
+
+    inline void SetTarget(float target) {
+        if (target == target_) return;
+        target_ = target;
+        step_ = (target - value_) / (float)ramp_blocks_;
+        remaining_ = ramp_blocks_;
+    }
+
+    // Advance one block; O(1), no branches taken in steady state.
+    inline float NextBlock() {
+        if (remaining_ > 0) {
+            value_ += step_;
+            if (--remaining_ == 0) value_ = target_;  // Land exactly
+        }
+        return value_;
+    }
+
+    inline float value() const { return value_; }
+
+private:
+    float value_, target_, step_;
+    int remaining_, ramp_blocks_;
+};
+
+// Multiplicative ramp: for frequencies, where equal-ratio steps sound
+// linear in pitch. One powf when the target changes (to get the per-block
+// ratio); the per-block cost is a single multiply.
+class SmoothedRatio {
+public:
+    SmoothedRatio() : value_(1.0f), target_(1.0f), ratio_(1.0f), remaining_(0), ramp_blocks_(1) {}
+
+    void Init(float initial, int ramp_blocks) {
+        value_ = target_ = initial;
+        ratio_ = 1.0f;
+        remaining_ = 0;
+        ramp_blocks_ = (ramp_blocks < 1) ? 1 : ramp_blocks;
+    }
+
+    inline void SetTarget(float target) {
+        if (target == target_ || target <= 0.0f || value_ <= 0.0f) {
+            target_ = (target > 0.0f) ? target : target_;
+            return;
+        }
+        target_ = target;
+        ratio_ = powf(target / value_, 1.0f / (float)ramp_blocks_);
+        remaining_ = ramp_blocks_;
+    }
+
+    inline float NextBlock() {
+        if (remaining_ > 0) {
+            value_ *= ratio_;
+            if (--remaining_ == 0) value_ = target_;  // Kill accumulated error
+        }
+        return value_;
+    }
+
+    inline float value() const { return value_; }
+
+private:
+    float value_, target_, ratio_;
+    int remaining_, ramp_blocks_;
+};
+
+}  // namespace dms
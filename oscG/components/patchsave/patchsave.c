@@ -0,0 +1,86 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs.h"
+#include "esp_log.h"
+#include "patchsave.h"
+
+static const char *TAG = "PATCH";
+
+typedef struct {
+    const char *key;
+    void *buf;
+    size_t len;
+} region_t;
+
+static region_t s_regions[PATCHSAVE_MAX_REGIONS];
+static int s_num_regions = 0;
+static nvs_handle_t s_nvs = 0;
+static bool s_ready = false;
+static volatile uint32_t s_dirty = 0;
+static TaskHandle_t s_writer = NULL;
+
+static void writer_task(void *arg) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // Debounce: keep waiting while edits are still arriving, so a
+        // knob sweep becomes one commit instead of hundreds.
+        uint32_t seen;
+        do {
+            seen = s_dirty;
+            vTaskDelay(pdMS_TO_TICKS(PATCHSAVE_DEBOUNCE_MS));
+        } while (seen != s_dirty);
+
+        // Regions are snapshotted live; an edit racing this loop at
+        // worst saves a mid-edit state that the next debounce corrects.
+        for (int i = 0; i < s_num_regions; i++) {
+            esp_err_t err = nvs_set_blob(s_nvs, s_regions[i].key,
+                                         s_regions[i].buf, s_regions[i].len);
+            if (err != ESP_OK) {
+                ESP_LOGW(TAG, "Save %s failed: %d", s_regions[i].key, err);
+            }
+        }
+        nvs_commit(s_nvs);
+        ESP_LOGI(TAG, "Patch saved (%d regions)", s_num_regions);
+    }
+}
+
+void patchsave_init(void) {
+    esp_err_t err = nvs_open("patch", NVS_READWRITE, &s_nvs);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "NVS open failed: %d, persistence disabled", err);
+        return;
+    }
+    if (xTaskCreate(writer_task, "patch_writer", 3072, NULL, 1, &s_writer) != pdPASS) {
+        ESP_LOGW(TAG, "Writer task creation failed, persistence disabled");
+        nvs_close(s_nvs);
+        return;
+    }
+    s_ready = true;
+}
+
+void patchsave_region(const char *key, void *buf, size_t len) {
+    if (!s_ready) return;
+    if (s_num_regions >= PATCHSAVE_MAX_REGIONS) {
+        ESP_LOGW(TAG, "Region table full, %s not persisted", key);
+        return;
+    }
+    s_regions[s_num_regions].key = key;
+    s_regions[s_num_regions].buf = buf;
+    s_regions[s_num_regions].len = len;
+    s_num_regions++;
+
+    // Restore only an exact-size match; anything else means the layout
+    // changed since the save and defaults are safer.
+    size_t saved_len = 0;
+    if (nvs_get_blob(s_nvs, key, NULL, &saved_len) == ESP_OK && saved_len == len) {
+        nvs_get_blob(s_nvs, key, buf, &saved_len);
+        ESP_LOGI(TAG, "Restored %s (%u bytes)", key, (unsigned)len);
+    }
+}
+
+void patchsave_mark_dirty(void) {
+    if (!s_ready) return;
+    s_dirty++;
+    xTaskNotifyGive(s_writer);
+}
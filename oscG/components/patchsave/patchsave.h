@@ -0,0 +1,48 @@
+#pragma once
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * NVS-backed patch persistence.
+ *
+ * Callers register the RAM regions that make up the patch (knob saved
+ * values, chase flags, multi-knob map, routing table) at init;
+ * registration immediately restores the saved bytes, so by the time the
+ * audio tasks start the module sounds like it did before the power
+ * cycle. Edits call patchsave_mark_dirty(), and a low-priority writer
+ * task snapshots every region to NVS once the edits have been quiet for
+ * PATCHSAVE_DEBOUNCE_MS — flash writes never happen on the audio or UI
+ * path, and knob twiddling coalesces into one commit.
+ *
+ * If patchsave_init() is never called (hwTest has no NVS), everything
+ * degrades to a no-op. A saved blob whose size doesn't match the
+ * registered region (schema changed) is ignored rather than restored.
+ */
+#define PATCHSAVE_MAX_REGIONS 8
+#define PATCHSAVE_DEBOUNCE_MS 2000
+
+/**
+ * @brief Open the NVS namespace and start the writer task.
+ *        Call after nvs_flash_init(), before registering regions.
+ */
+void patchsave_init(void);
+
+/**
+ * @brief Register a patch region and restore its saved contents into
+ *        buf, if a same-sized blob exists. key must outlive the call
+ *        (use a literal) and be <= 15 chars (NVS limit).
+ */
+void patchsave_region(const char *key, void *buf, size_t len);
+
+/**
+ * @brief Note that some registered region changed; the writer task
+ *        persists everything after the edits go quiet.
+ */
+void patchsave_mark_dirty(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <string.h>
+#include "esp_cpu.h"
+#include "perfmon.h"
+
+#define PERF_BUCKETS 16  // Log2 buckets: <2^6 .. >=2^20 cycles
+
+// All static: no allocation, no locks. Each stage is begun/ended from a
+// single task, so plain stores are enough; dump reads racily but is
+// diagnostic-only.
+typedef struct {
+    uint32_t start;
+    uint32_t hist[PERF_BUCKETS];
+    uint32_t count;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} perf_slot_t;
+
+static perf_slot_t slots[PERF_STAGE_COUNT];
+
+static const char *stage_names[PERF_STAGE_COUNT] = {
+    "render", "pack", "send", "ui_poll"
+};
+
+void perfmon_begin(perf_stage_t stage) {
+    slots[stage].start = esp_cpu_get_cycle_count();
+}
+
+void perfmon_end(perf_stage_t stage) {
+    perf_slot_t *s = &slots[stage];
+    uint32_t d = esp_cpu_get_cycle_count() - s->start;
+    // Bucket 0 holds everything under 2^6 cycles, the last is open-ended
+    int bucket = 31 - __builtin_clz(d | 1) - 6;
+    if (bucket < 0) bucket = 0;
+    if (bucket >= PERF_BUCKETS) bucket = PERF_BUCKETS - 1;
+    s->hist[bucket]++;
+    s->count++;
+    s->total_cycles += d;
+    if (d > s->max_cycles) s->max_cycles = d;
+}
+
+void perfmon_dump(void) {
+    printf("perfmon: stage / count / avg / max cycles, then log2 buckets from 2^6\n");
+    for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+        perf_slot_t *s = &slots[i];
+        if (s->count == 0) continue;
+        printf("%8s: n=%lu avg=%lu max=%lu\n", stage_names[i],
+               (unsigned long)s->count,
+               (unsigned long)(s->total_cycles / s->count),
+               (unsigned long)s->max_cycles);
+        printf("          ");
+        for (int b = 0; b < PERF_BUCKETS; b++) {
+            printf("%lu ", (unsigned long)s->hist[b]);
+        }
+        printf("\n");
+    }
+    memset(slots, 0, sizeof(slots));  // Fresh window after every dump
+}
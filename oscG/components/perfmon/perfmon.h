@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pipeline stages we time. Shared across binaries so dumps read the same
+ * everywhere; unused stages just stay empty.
+ */
+typedef enum {
+    PERF_STAGE_RENDER = 0,  // Oscillator block synthesis + mix
+    PERF_STAGE_PACK,        // Float block -> 24-bit wire format
+    PERF_STAGE_SEND,        // netconn_sendto / sendto
+    PERF_STAGE_UI_POLL,     // One updateUITask tick (buttons + knobs)
+    PERF_STAGE_COUNT
+} perf_stage_t;
+
+/**
+ * @brief Start timing a stage (one cycle-counter read and a store).
+ */
+void perfmon_begin(perf_stage_t stage);
+
+/**
+ * @brief Finish timing a stage: one cycle read, a log2 bucket increment
+ *        and a max-watermark compare. Safe at 500Hz on the audio path.
+ */
+void perfmon_end(perf_stage_t stage);
+
+/**
+ * @brief printf all per-stage histograms and watermarks, then reset.
+ *        Call from a button press or a low-priority task — never from
+ *        the audio tick.
+ */
+void perfmon_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+"""Generate the semitone-ratio table for pitchlut.
+
+Writes pitchlut_tables.c: 2^(x/12) sampled at STEPS+1 points across
+x in [-SPAN, +SPAN] semitones, for linear interpolation. Run from this
+directory after changing the constants (keep them in sync with
+pitchlut.h); the generated file is committed so builds don't need
+Python.
+"""
+
+STEPS = 512
+SPAN = 24.0  # Semitones either side of unison
+
+
+def main():
+    with open("pitchlut_tables.c", "w") as f:
+        f.write("// Generated by gen_pitchlut.py — do not edit by hand.\n")
+        f.write('#include "pitchlut.h"\n\n')
+        f.write("// 2^(x/12), x from -%g to +%g semitones\n" % (SPAN, SPAN))
+        f.write("const float pitchlut_ratio_table[PITCHLUT_STEPS + 1] = {")
+        for i in range(STEPS + 1):
+            if i % 6 == 0:
+                f.write("\n    ")
+            st = -SPAN + 2.0 * SPAN * i / STEPS
+            f.write("%.8ff, " % (2.0 ** (st / 12.0)))
+        f.write("\n};\n")
+
+
+if __name__ == "__main__":
+    main()
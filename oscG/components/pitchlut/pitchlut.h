@@ -0,0 +1,70 @@
+#pragma once
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Quantized knob-to-pitch mapping.
+ *
+ * Noisy ADCs make the knob snapshot generation tick almost every UI
+ * update even after hysteresis, and the pitch recompute behind it costs
+ * powf calls. This module makes the steady-state cost of a jittery knob
+ * zero: knob positions quantize to PITCHLUT_STEPS discrete steps (the
+ * caller skips recomputation when the step is unchanged), and the
+ * semitone-to-ratio conversion itself is an interpolated read of a
+ * table generated offline by gen_pitchlut.py into flash rodata.
+ *
+ * 512 steps over a knob's travel is finer than the ADC hysteresis
+ * already allows through, so quantization adds no audible stepping.
+ */
+#define PITCHLUT_STEPS 512
+#define PITCHLUT_SPAN_SEMITONES 24.0f  // Table covers 2^(-2)..2^(+2)
+
+extern const float pitchlut_ratio_table[PITCHLUT_STEPS + 1];
+
+/**
+ * @brief Quantize a 0..1 knob value to a step index (0..PITCHLUT_STEPS-1).
+ */
+static inline int pitchlut_quantize(float knob) {
+    int step = (int)(knob * (float)PITCHLUT_STEPS);
+    if (step < 0) step = 0;
+    if (step > PITCHLUT_STEPS - 1) step = PITCHLUT_STEPS - 1;
+    return step;
+}
+
+/**
+ * @brief Center of a quantized step, back in 0..1 knob units.
+ */
+static inline float pitchlut_step_value(int step) {
+    return ((float)step + 0.5f) * (1.0f / (float)PITCHLUT_STEPS);
+}
+
+/**
+ * @brief 2^(semitones/12) by table interpolation, |semitones| <= 24.
+ */
+static inline float pitchlut_ratio(float semitones) {
+    float x = (semitones + PITCHLUT_SPAN_SEMITONES) *
+              ((float)PITCHLUT_STEPS / (2.0f * PITCHLUT_SPAN_SEMITONES));
+    if (x < 0.0f) x = 0.0f;
+    if (x > (float)PITCHLUT_STEPS) x = (float)PITCHLUT_STEPS;
+    int i = (int)x;
+    if (i > PITCHLUT_STEPS - 1) i = PITCHLUT_STEPS - 1;
+    float frac = x - (float)i;
+    return pitchlut_ratio_table[i] +
+           frac * (pitchlut_ratio_table[i + 1] - pitchlut_ratio_table[i]);
+}
+
+/**
+ * @brief 2^(semitones/12) for any range: whole octaves split off via
+ *        exponent manipulation (ldexpf), remainder from the table.
+ */
+static inline float pitchlut_ratio_wide(float semitones) {
+    int oct = (int)floorf(semitones * (1.0f / 12.0f));
+    return ldexpf(pitchlut_ratio(semitones - 12.0f * (float)oct), oct);
+}
+
+#ifdef __cplusplus
+}
+#endif
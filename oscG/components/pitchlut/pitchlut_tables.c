@@ -0,0 +1,92 @@
+// Generated by gen_pitchlut.py — do not edit by hand.
+#include "pitchlut.h"
+
+// 2^(x/12), x from -24 to +24 semitones
+const float pitchlut_ratio_table[PITCHLUT_STEPS + 1] = {
+    0.25000000f, 0.25135748f, 0.25272232f, 0.25409458f, 0.25547429f, 0.25686149f, 
+    0.25825622f, 0.25965853f, 0.26106845f, 0.26248602f, 0.26391129f, 0.26534431f, 
+    0.26678510f, 0.26823372f, 0.26969020f, 0.27115459f, 0.27262693f, 0.27410727f, 
+    0.27559565f, 0.27709210f, 0.27859669f, 0.28010944f, 0.28163040f, 0.28315963f, 
+    0.28469716f, 0.28624304f, 0.28779731f, 0.28936002f, 0.29093121f, 0.29251094f, 
+    0.29409925f, 0.29569618f, 0.29730178f, 0.29891610f, 0.30053918f, 0.30217108f, 
+    0.30381184f, 0.30546151f, 0.30712013f, 0.30878777f, 0.31046445f, 0.31215024f, 
+    0.31384519f, 0.31554934f, 0.31726274f, 0.31898544f, 0.32071750f, 0.32245897f, 
+    0.32420989f, 0.32597032f, 0.32774030f, 0.32951990f, 0.33130916f, 0.33310814f, 
+    0.33491688f, 0.33673545f, 0.33856389f, 0.34040226f, 0.34225061f, 0.34410899f, 
+    0.34597747f, 0.34785609f, 0.34974492f, 0.35164400f, 0.35355339f, 0.35547315f, 
+    0.35740333f, 0.35934400f, 0.36129520f, 0.36325700f, 0.36522945f, 0.36721261f, 
+    0.36920654f, 0.37121129f, 0.37322693f, 0.37525352f, 0.37729111f, 0.37933976f, 
+    0.38139954f, 0.38347050f, 0.38555271f, 0.38764622f, 0.38975110f, 0.39186741f, 
+    0.39399521f, 0.39613457f, 0.39828554f, 0.40044819f, 0.40262258f, 0.40480878f, 
+    0.40700686f, 0.40921686f, 0.41143887f, 0.41367294f, 0.41591915f, 0.41817754f, 
+    0.42044821f, 0.42273120f, 0.42502659f, 0.42733444f, 0.42965482f, 0.43198781f, 
+    0.43433346f, 0.43669185f, 0.43906304f, 0.44144711f, 0.44384412f, 0.44625415f, 
+    0.44867727f, 0.45111354f, 0.45356304f, 0.45602585f, 0.45850202f, 0.46099164f, 
+    0.46349478f, 0.46601151f, 0.46854191f, 0.47108604f, 0.47364400f, 0.47621584f, 
+    0.47880164f, 0.48140149f, 0.48401545f, 0.48664360f, 0.48928603f, 0.49194281f, 
+    0.49461401f, 0.49729971f, 0.50000000f, 0.50271495f, 0.50544464f, 0.50818916f, 
+    0.51094857f, 0.51372297f, 0.51651244f, 0.51931705f, 0.52213689f, 0.52497204f, 
+    0.52782259f, 0.53068861f, 0.53357020f, 0.53646743f, 0.53938040f, 0.54230918f, 
+    0.54525387f, 0.54821454f, 0.55119129f, 0.55418421f, 0.55719337f, 0.56021888f, 
+    0.56326081f, 0.56631926f, 0.56939432f, 0.57248607f, 0.57559461f, 0.57872004f, 
+    0.58186243f, 0.58502188f, 0.58819850f, 0.59139236f, 0.59460356f, 0.59783220f, 
+    0.60107837f, 0.60434216f, 0.60762368f, 0.61092302f, 0.61424027f, 0.61757553f, 
+    0.62092891f, 0.62430049f, 0.62769038f, 0.63109868f, 0.63452548f, 0.63797089f, 
+    0.64143501f, 0.64491794f, 0.64841978f, 0.65194063f, 0.65548061f, 0.65903980f, 
+    0.66261832f, 0.66621627f, 0.66983376f, 0.67347089f, 0.67712777f, 0.68080451f, 
+    0.68450121f, 0.68821799f, 0.69195494f, 0.69571219f, 0.69948984f, 0.70328800f, 
+    0.70710678f, 0.71094630f, 0.71480667f, 0.71868800f, 0.72259040f, 0.72651400f, 
+    0.73045890f, 0.73442522f, 0.73841307f, 0.74242258f, 0.74645386f, 0.75050703f, 
+    0.75458221f, 0.75867952f, 0.76279908f, 0.76694100f, 0.77110541f, 0.77529244f, 
+    0.77950220f, 0.78373482f, 0.78799042f, 0.79226913f, 0.79657108f, 0.80089638f, 
+    0.80524517f, 0.80961757f, 0.81401371f, 0.81843372f, 0.82287774f, 0.82734588f, 
+    0.83183829f, 0.83635509f, 0.84089642f, 0.84546240f, 0.85005318f, 0.85466888f, 
+    0.85930965f, 0.86397562f, 0.86866692f, 0.87338369f, 0.87812608f, 0.88289422f, 
+    0.88768825f, 0.89250831f, 0.89735454f, 0.90222708f, 0.90712609f, 0.91205169f, 
+    0.91700404f, 0.92198328f, 0.92698956f, 0.93202302f, 0.93708382f, 0.94217209f, 
+    0.94728799f, 0.95243167f, 0.95760328f, 0.96280297f, 0.96803090f, 0.97328721f, 
+    0.97857206f, 0.98388561f, 0.98922801f, 0.99459942f, 1.00000000f, 1.00542990f, 
+    1.01088929f, 1.01637831f, 1.02189715f, 1.02744595f, 1.03302488f, 1.03863410f, 
+    1.04427378f, 1.04994409f, 1.05564518f, 1.06137723f, 1.06714040f, 1.07293487f, 
+    1.07876080f, 1.08461836f, 1.09050773f, 1.09642908f, 1.10238258f, 1.10836841f, 
+    1.11438674f, 1.12043775f, 1.12652162f, 1.13263852f, 1.13878863f, 1.14497214f, 
+    1.15118923f, 1.15744007f, 1.16372486f, 1.17004377f, 1.17639699f, 1.18278471f, 
+    1.18920712f, 1.19566439f, 1.20215673f, 1.20868432f, 1.21524736f, 1.22184603f, 
+    1.22848054f, 1.23515106f, 1.24185781f, 1.24860098f, 1.25538076f, 1.26219735f, 
+    1.26905096f, 1.27594178f, 1.28287002f, 1.28983587f, 1.29683955f, 1.30388127f, 
+    1.31096121f, 1.31807960f, 1.32523664f, 1.33243255f, 1.33966752f, 1.34694179f, 
+    1.35425555f, 1.36160902f, 1.36900242f, 1.37643597f, 1.38390988f, 1.39142438f, 
+    1.39897967f, 1.40657599f, 1.41421356f, 1.42189260f, 1.42961334f, 1.43737600f, 
+    1.44518081f, 1.45302800f, 1.46091779f, 1.46885043f, 1.47682615f, 1.48484517f, 
+    1.49290773f, 1.50101407f, 1.50916443f, 1.51735904f, 1.52559815f, 1.53388200f, 
+    1.54221083f, 1.55058488f, 1.55900440f, 1.56746964f, 1.57598085f, 1.58453827f, 
+    1.59314215f, 1.60179276f, 1.61049033f, 1.61923514f, 1.62802742f, 1.63686745f, 
+    1.64575548f, 1.65469177f, 1.66367658f, 1.67271018f, 1.68179283f, 1.69092480f, 
+    1.70010635f, 1.70933776f, 1.71861930f, 1.72795123f, 1.73733384f, 1.74676739f, 
+    1.75625216f, 1.76578844f, 1.77537649f, 1.78501661f, 1.79470908f, 1.80445417f, 
+    1.81425218f, 1.82410339f, 1.83400809f, 1.84396657f, 1.85397913f, 1.86404605f, 
+    1.87416763f, 1.88434418f, 1.89457598f, 1.90486334f, 1.91520656f, 1.92560594f, 
+    1.93606179f, 1.94657442f, 1.95714412f, 1.96777122f, 1.97845603f, 1.98919885f, 
+    2.00000000f, 2.01085980f, 2.02177857f, 2.03275663f, 2.04379430f, 2.05489190f, 
+    2.06604976f, 2.07726820f, 2.08854756f, 2.09988817f, 2.11129036f, 2.12275445f, 
+    2.13428080f, 2.14586974f, 2.15752160f, 2.16923672f, 2.18101547f, 2.19285816f, 
+    2.20476517f, 2.21673682f, 2.22877349f, 2.24087550f, 2.25304324f, 2.26527704f, 
+    2.27757727f, 2.28994429f, 2.30237846f, 2.31488015f, 2.32744972f, 2.34008754f, 
+    2.35279398f, 2.36556942f, 2.37841423f, 2.39132878f, 2.40431346f, 2.41736865f, 
+    2.43049472f, 2.44369207f, 2.45696107f, 2.47030213f, 2.48371562f, 2.49720195f, 
+    2.51076151f, 2.52439470f, 2.53810191f, 2.55188356f, 2.56574003f, 2.57967175f, 
+    2.59367911f, 2.60776253f, 2.62192242f, 2.63615920f, 2.65047329f, 2.66486509f, 
+    2.67933505f, 2.69388357f, 2.70851109f, 2.72321804f, 2.73800485f, 2.75287194f, 
+    2.76781976f, 2.78284875f, 2.79795935f, 2.81315199f, 2.82842712f, 2.84378520f, 
+    2.85922668f, 2.87475199f, 2.89036161f, 2.90605599f, 2.92183559f, 2.93770087f, 
+    2.95365229f, 2.96969033f, 2.98581546f, 3.00202814f, 3.01832886f, 3.03471808f, 
+    3.05119630f, 3.06776400f, 3.08442165f, 3.10116976f, 3.11800880f, 3.13493928f, 
+    3.15196169f, 3.16907653f, 3.18628430f, 3.20358551f, 3.22098066f, 3.23847027f, 
+    3.25605484f, 3.27373490f, 3.29151096f, 3.30938354f, 3.32735316f, 3.34542036f, 
+    3.36358566f, 3.38184960f, 3.40021271f, 3.41867553f, 3.43723860f, 3.45590246f, 
+    3.47466767f, 3.49353477f, 3.51250432f, 3.53157687f, 3.55075299f, 3.57003322f, 
+    3.58941815f, 3.60890834f, 3.62850435f, 3.64820677f, 3.66801617f, 3.68793314f, 
+    3.70795825f, 3.72809210f, 3.74833527f, 3.76868836f, 3.78915196f, 3.80972668f, 
+    3.83041312f, 3.85121189f, 3.87212359f, 3.89314884f, 3.91428825f, 3.93554245f, 
+    3.95691205f, 3.97839769f, 4.00000000f, 
+};
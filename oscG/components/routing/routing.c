@@ -0,0 +1,60 @@
+#include <string.h>
+#include "routing.h"
+
+void routing_init(routing_table_t *rt) {
+    memset(rt, 0, sizeof(*rt));
+}
+
+int routing_register_dest(routing_table_t *rt, const char *name, float initial) {
+    if (rt->num_dests >= ROUTING_MAX_DESTS) return -1;
+    int slot = rt->num_dests++;
+    rt->dst_names[slot] = name;
+    rt->dst_values[slot] = initial;
+    return slot;
+}
+
+// Find the route currently driving dst, or a free entry to hold one.
+static route_t *find_route(routing_table_t *rt, int dst) {
+    for (int i = 0; i < rt->num_routes; ++i) {
+        if (rt->routes[i].dst == (uint8_t)dst) return &rt->routes[i];
+    }
+    if (rt->num_routes >= ROUTING_MAX_ROUTES) return 0;
+    return &rt->routes[rt->num_routes];
+}
+
+bool set_virtual_route(routing_table_t *rt, uint8_t src, int dst,
+                       float scale, float offset) {
+    if (dst < 0 || dst >= rt->num_dests) return false;
+    route_t *r = find_route(rt, dst);
+    if (r == 0) return false;
+
+    // Deactivate first so a concurrent routing_apply on the other core
+    // skips the entry while it is half-written. The exchange is ACQ_REL
+    // so the field stores below cannot be hoisted above it, and the
+    // release store of true publishes them — a plain bool write gave
+    // the compiler and the other core no such ordering.
+    (void)__atomic_exchange_n(&r->active, false, __ATOMIC_ACQ_REL);
+    if (src == ROUTING_SRC_NONE) {
+        rt->gen++;
+        return true;  // Destination keeps its last value
+    }
+    r->src = src;
+    r->dst = (uint8_t)dst;
+    r->scale = scale;
+    r->offset = offset;
+    if (r == &rt->routes[rt->num_routes]) rt->num_routes++;
+    __atomic_store_n(&r->active, true, __ATOMIC_RELEASE);
+    rt->gen++;
+    return true;
+}
+
+void routing_apply(routing_table_t *rt, const float *src_values) {
+    for (int i = 0; i < rt->num_routes; ++i) {
+        const route_t *r = &rt->routes[i];
+        // Acquire pairs with the release in set_virtual_route: a true
+        // here means the fields behind it are fully published.
+        if (__atomic_load_n(&r->active, __ATOMIC_ACQUIRE)) {
+            rt->dst_values[r->dst] = src_values[r->src] * r->scale + r->offset;
+        }
+    }
+}
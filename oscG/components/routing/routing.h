@@ -0,0 +1,86 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Patch routing table: sources to destinations, O(1) flat dispatch.
+ *
+ * The "set_virtual_route(POT_ADC3, OSC_FREQ)" TODO, built for real.
+ * Sources are indices into a flat float array the caller passes per
+ * block (knob snapshot today; received control streams can extend the
+ * index space later). Destinations are slots a binary registers at
+ * init, each with a name used only for edit-time logging — dispatch is
+ * pure array indexing, no strings, no callbacks.
+ *
+ * routing_apply walks the compact route list once per block:
+ *   dst_values[r->dst] = src_values[r->src] * scale + offset
+ * so adding a destination is a registration call, not an edit to the
+ * audio loop.
+ *
+ * Edits come from the UI task while the sender reads; a route flips
+ * active around field updates so a concurrent apply sees either the
+ * old or no route, and the generation counter tells consumers to
+ * re-derive even when the knobs are idle.
+ */
+#define ROUTING_MAX_ROUTES 16
+#define ROUTING_MAX_DESTS 16
+#define ROUTING_SRC_NONE 0xFF
+
+typedef struct {
+    uint8_t src;    // Index into the caller's source value array
+    uint8_t dst;    // Registered destination slot
+    bool active;
+    float scale;
+    float offset;
+} route_t;
+
+typedef struct {
+    route_t routes[ROUTING_MAX_ROUTES];
+    int num_routes;
+    float dst_values[ROUTING_MAX_DESTS];
+    const char *dst_names[ROUTING_MAX_DESTS];
+    int num_dests;
+    volatile uint32_t gen;  // Bumped on every edit
+} routing_table_t;
+
+/**
+ * @brief Reset the table to no destinations and no routes.
+ */
+void routing_init(routing_table_t *rt);
+
+/**
+ * @brief Register a destination slot at init time.
+ * @param name For edit-time logs only; the pointer is kept, not copied.
+ * @param initial Value the destination holds until a route drives it.
+ * @return Slot index (dense, in registration order), or -1 if full.
+ */
+int routing_register_dest(routing_table_t *rt, const char *name, float initial);
+
+/**
+ * @brief Route a source to a destination (replacing any existing route
+ *        to that destination). src = ROUTING_SRC_NONE clears the route;
+ *        the destination then holds its last value.
+ * @return true on success.
+ */
+bool set_virtual_route(routing_table_t *rt, uint8_t src, int dst,
+                       float scale, float offset);
+
+/**
+ * @brief Evaluate every active route against this block's source values.
+ */
+void routing_apply(routing_table_t *rt, const float *src_values);
+
+/**
+ * @brief Current value of a destination slot.
+ */
+static inline float routing_value(const routing_table_t *rt, int dst) {
+    return rt->dst_values[dst];
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,130 @@
+#include <string.h>
+#include "topomgr.h"
+
+void topo_init(topo_table_t *t) {
+    memset(t, 0, sizeof(*t));
+}
+
+void topo_write_announce(topo_announce_t *a, const char *name, uint8_t type,
+                         uint32_t group_netorder, uint16_t port, uint16_t rate) {
+    memset(a, 0, sizeof(*a));
+    a->magic = TOPO_MAGIC;
+    a->version = TOPO_VERSION;
+    a->type = type;
+    a->group = group_netorder;
+    a->port = port;
+    a->rate = rate;
+    strncpy(a->name, name, TOPO_NAME_LEN - 1);  // memset keeps the NUL
+}
+
+static topo_stream_t *find_entry(topo_table_t *t, const char *name) {
+    for (int i = 0; i < t->num_streams; i++) {
+        if (strncmp(t->streams[i].name, name, TOPO_NAME_LEN) == 0) {
+            return &t->streams[i];
+        }
+    }
+    return NULL;
+}
+
+int topo_ingest(topo_table_t *t, const uint8_t *data, int len, int64_t now_us) {
+    if (len != (int)sizeof(topo_announce_t)) return 0;
+    topo_announce_t a;
+    memcpy(&a, data, sizeof(a));  // Datagram buffer may be unaligned
+    if (a.magic != TOPO_MAGIC || a.version != TOPO_VERSION) return 0;
+    a.name[TOPO_NAME_LEN - 1] = '\0';
+    if (a.name[0] == '\0') return 0;
+
+    topo_stream_t *s = find_entry(t, a.name);
+    if (!s) {
+        if (t->num_streams >= TOPO_MAX_STREAMS) return 0;  // Directory full
+        s = &t->streams[t->num_streams++];
+        memset(s, 0, sizeof(*s));
+        memcpy(s->name, a.name, TOPO_NAME_LEN);
+    }
+    // A re-announce may move the stream (module renumbered after DHCP);
+    // the group change makes the old join stale, and topo_update re-joins
+    // at the new address because joined is cleared here.
+    if (s->joined && s->group != a.group) s->joined = 0;
+    s->type = a.type;
+    s->group = a.group;
+    s->port = a.port;
+    s->rate = a.rate;
+    s->last_seen_us = now_us;
+    return 1;
+}
+
+static int is_wanted(const topo_table_t *t, const char *name) {
+    for (int i = 0; i < t->num_wanted; i++) {
+        if (strncmp(t->wanted[i], name, TOPO_NAME_LEN) == 0) return 1;
+    }
+    return 0;
+}
+
+int topo_want(topo_table_t *t, const char *name) {
+    if (name[0] == '\0' || is_wanted(t, name)) return 0;
+    if (t->num_wanted >= TOPO_MAX_WANTED) return -1;
+    strncpy(t->wanted[t->num_wanted], name, TOPO_NAME_LEN - 1);
+    t->wanted[t->num_wanted][TOPO_NAME_LEN - 1] = '\0';
+    t->num_wanted++;
+    return 0;
+}
+
+void topo_unwant(topo_table_t *t, const char *name) {
+    for (int i = 0; i < t->num_wanted; i++) {
+        if (strncmp(t->wanted[i], name, TOPO_NAME_LEN) == 0) {
+            t->num_wanted--;
+            memmove(&t->wanted[i], &t->wanted[i + 1],
+                    (t->num_wanted - i) * TOPO_NAME_LEN);
+            return;
+        }
+    }
+}
+
+static void emit(topo_action_t *a, int join, const topo_stream_t *s) {
+    a->join = (uint8_t)join;
+    a->group = s->group;
+    a->port = s->port;
+    memcpy(a->name, s->name, TOPO_NAME_LEN);
+}
+
+int topo_update(topo_table_t *t, int64_t now_us,
+                topo_action_t *actions, int max_actions) {
+    int n = 0;
+    for (int i = 0; i < t->num_streams && n < max_actions; ) {
+        topo_stream_t *s = &t->streams[i];
+        if (now_us - s->last_seen_us > TOPO_STREAM_TTL_US) {
+            // Announcer fell silent: drop the join and evict the entry;
+            // a want for it stays pending until it announces again
+            if (s->joined) emit(&actions[n++], 0, s);
+            t->num_streams--;
+            memmove(s, s + 1, (t->num_streams - i) * sizeof(*s));
+            continue;
+        }
+        // joined flips only in topo_ack_action once the stack call has
+        // succeeded, so an action the caller could not apply (conn not
+        // up yet, join failed) is simply re-emitted next update.
+        int want = is_wanted(t, s->name);
+        if (want && !s->joined) {
+            emit(&actions[n++], 1, s);
+        } else if (!want && s->joined) {
+            emit(&actions[n++], 0, s);
+        }
+        i++;
+    }
+    return n;
+}
+
+void topo_ack_action(topo_table_t *t, const topo_action_t *a) {
+    topo_stream_t *s = find_entry(t, a->name);
+    // An evicted entry (TTL leave) is already gone; nothing to record
+    if (s && s->group == a->group) s->joined = a->join;
+}
+
+const topo_stream_t *topo_find(const topo_table_t *t, const char *name) {
+    for (int i = 0; i < t->num_streams; i++) {
+        if (strncmp(t->streams[i].name, name, TOPO_NAME_LEN) == 0) {
+            return &t->streams[i];
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <stdint.h>
+#include "wireconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Runtime stream topology: announce and lazy subscription.
+ *
+ * Every module multicasts a small announce for each stream it produces
+ * (name, type, group, port, rate) once a second on the well-known
+ * announce group, so the rack is discoverable without the receiver
+ * hardcoding the 239.100.x.y arithmetic for every source. Receivers
+ * declare which stream NAMES they currently reference (topo_want /
+ * topo_unwant, driven by the patch) and topo_update diffs that against
+ * the live directory into join/leave actions: a group is joined only
+ * while a patch cord actually references it, and dropped again when the
+ * reference goes away or the announcer falls silent (TTL). Per-module
+ * switch bandwidth then scales with active patch cords, not with the
+ * total number of modules flooding 1.15 Mbps each.
+ *
+ * Like clocksync and ctlstream, this header is transport-agnostic
+ * (freestanding) — the announce/listen task and the IGMP calls live in
+ * the binaries. test_module/connection_protocol.py prototypes the
+ * jack-level handshake on top; this component is the directory and
+ * membership layer underneath it.
+ */
+
+#define TOPO_MAGIC 0x4454  // "DT"
+#define TOPO_VERSION 1
+#define TOPO_PORT 5008
+#define TOPO_ANNOUNCE_GROUP "239.100.0.2"  // Well-known, every module joins
+#define TOPO_ANNOUNCE_INTERVAL_MS 1000
+#define TOPO_STREAM_TTL_US 3500000  // Three missed announces = stale
+
+#define TOPO_NAME_LEN 16
+#define TOPO_MAX_STREAMS 16  // Directory capacity (rack-sized)
+#define TOPO_MAX_WANTED 4    // Streams one module can reference at once
+
+// Stream types, for compatibility checks at patch time
+#define TOPO_TYPE_AUDIO 1    // WIRE_AUDIO_PORT blocks
+#define TOPO_TYPE_CONTROL 2  // ctlstream frames
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;            // TOPO_MAGIC, little-endian on the wire
+    uint8_t version;           // TOPO_VERSION
+    uint8_t type;              // TOPO_TYPE_*
+    uint32_t group;            // Stream group, network byte order
+    uint16_t port;             // Stream port, host order
+    uint16_t rate;             // Packets per second (500 for audio)
+    char name[TOPO_NAME_LEN];  // NUL-padded stream name
+} topo_announce_t;
+
+#ifdef __cplusplus
+static_assert(sizeof(topo_announce_t) == 28, "announce must stay 28 bytes");
+#else
+_Static_assert(sizeof(topo_announce_t) == 28, "announce must stay 28 bytes");
+#endif
+
+/** One directory entry, refreshed by announces. */
+typedef struct {
+    char name[TOPO_NAME_LEN];
+    uint8_t type;
+    uint8_t joined;       // This module is currently subscribed
+    uint32_t group;       // Network byte order, as announced
+    uint16_t port;
+    uint16_t rate;
+    int64_t last_seen_us;
+} topo_stream_t;
+
+/** A membership change topo_update wants applied. */
+typedef struct {
+    uint8_t join;         // 1 = join the group, 0 = leave it
+    uint32_t group;       // Network byte order
+    uint16_t port;
+    char name[TOPO_NAME_LEN];
+} topo_action_t;
+
+typedef struct {
+    topo_stream_t streams[TOPO_MAX_STREAMS];
+    int num_streams;
+    char wanted[TOPO_MAX_WANTED][TOPO_NAME_LEN];
+    int num_wanted;
+} topo_table_t;
+
+void topo_init(topo_table_t *t);
+
+/**
+ * @brief Fill in an announce for one of this module's streams.
+ */
+void topo_write_announce(topo_announce_t *a, const char *name, uint8_t type,
+                         uint32_t group_netorder, uint16_t port, uint16_t rate);
+
+/**
+ * @brief Feed one received datagram (validated here) with the local
+ *        receive timestamp; refreshes or creates the directory entry.
+ * @return 1 if the announce was accepted, 0 otherwise.
+ */
+int topo_ingest(topo_table_t *t, const uint8_t *data, int len,
+                int64_t now_us);
+
+/**
+ * @brief Reference / drop a stream by name. Call when the patch starts
+ *        or stops using it; the join happens on the next topo_update
+ *        once the stream is (still) announced.
+ */
+int topo_want(topo_table_t *t, const char *name);
+void topo_unwant(topo_table_t *t, const char *name);
+
+/**
+ * @brief Diff wants against the live directory: joins for wanted streams
+ *        not yet subscribed, leaves for subscriptions no longer wanted
+ *        or gone stale (announcer silent past the TTL; the entry is
+ *        evicted). Call periodically from the topology task, apply each
+ *        action with the stack's join/leave primitive, and confirm the
+ *        ones that succeeded with topo_ack_action — unconfirmed actions
+ *        are re-emitted on the next update.
+ * @return Number of actions written (at most max_actions).
+ */
+int topo_update(topo_table_t *t, int64_t now_us,
+                topo_action_t *actions, int max_actions);
+
+/**
+ * @brief Record that an action was applied. Only this flips the entry's
+ *        joined state, so the table never believes in a join or leave
+ *        the stack refused.
+ */
+void topo_ack_action(topo_table_t *t, const topo_action_t *a);
+
+/** @brief Look up a live stream by name, NULL if unknown. */
+const topo_stream_t *topo_find(const topo_table_t *t, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
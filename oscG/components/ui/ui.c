@@ -5,10 +5,15 @@
 #include <string.h>  // For memset
 #include "esp_log.h"
 #include "driver/gpio.h"
+#include "driver/spi_master.h"
 #include "esp_adc/adc_oneshot.h"
+#include "esp_adc/adc_continuous.h"
 #include "esp_timer.h"  // For button timing
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "perfmon.h"
+#include "patchsave.h"
+#include "dlog.h"
 #include "ui.h"
 
 #define NUM_KNOBS 16  // Expanded to 16 (8 physical + 8 virtual)
@@ -31,7 +36,36 @@ static struct {
 
 static const char *TAG = "UI";
 
-volatile uint8_t knobsUpdated = 0;  // Global flag for knob changes
+volatile uint8_t knobsUpdated = 0;  // Global flag for knob changes (legacy; prefer knobBox)
+
+parambox_t knobBox = {0};  // Seqlock snapshot of all knob values, published on change
+static float current_knob_values[NUM_KNOBS] = {0.5f};  // Last read value per knob
+static bool knob_registered[NUM_KNOBS] = {false};      // Scanned by updateUITask
+
+// Dense scan schedule: registered knobs only, compiled at setKnobParam
+// time so the tick loop never walks the 16 slots. Knobs that changed
+// recently stay "hot" and sample every tick; idle knobs drop to 1/8
+// rate (staggered so they don't bunch on one tick).
+static knob_index_t scan_list[NUM_KNOBS];
+static int scan_count = 0;
+static uint8_t knob_hot[NUM_KNOBS];      // Ticks of every-tick sampling left
+#define KNOB_HOT_TICKS 64                // ~1.3s at the UI rate
+#define KNOB_IDLE_DIV 8                  // Idle sampling rate divisor
+
+// Per-physical-knob virtual-mode lookup, precomputed from multi_knob_map
+// so readKnob doesn't re-walk the whole map on every read.
+static uint8_t mk_btn[NUM_KNOBS];        // 0 = no mapping
+static knob_index_t mk_virt[NUM_KNOBS];
+
+static void rebuildMultiKnobLut(void) {
+    memset(mk_btn, 0, sizeof(mk_btn));
+    for (int i = 0; i < NUM_KNOBS; i++) {
+        if (multi_knob_map[i].btn != 0) {
+            mk_btn[multi_knob_map[i].phys_knob] = multi_knob_map[i].btn;
+            mk_virt[multi_knob_map[i].phys_knob] = multi_knob_map[i].virt_knob;
+        }
+    }
+}
 
 // Button globals (simplified, no double-click)
 static bool buttonCurrentStatus[BUTTONSCOUNT] = {false};
@@ -42,6 +76,14 @@ static bool longPressDetected[BUTTONSCOUNT] = {false};  // Flag for long press
 static uint16_t prev_button_state = 0;  // For reg change log
 static button_callback_t g_button_cb = NULL;  // Global cb
 
+// Long presses fire at the threshold, not on release: a one-shot
+// esp_timer armed on the press edge sets a bit in long_fire_mask, and
+// pollButtons dispatches it on the next tick. One timer, re-armed per
+// press — this is a one-finger panel.
+static esp_timer_handle_t long_press_timer = NULL;
+static volatile int long_press_armed = -1;      // Button index the one-shot watches
+static volatile uint16_t long_fire_mask = 0;    // Set by the timer, drained by pollButtons
+
 volatile StateType LedState[LEDCOUNT] = {RESET};
 volatile bool LedBlinkState[LEDCOUNT] = {false};
 volatile uint32_t LedBlinkCount[LEDCOUNT] = {0};  // Cycles for blink timing
@@ -72,49 +114,219 @@ static adc_config_t adc_configs[] = {
 static adc_oneshot_unit_handle_t adc1_handle;
 static adc_oneshot_unit_handle_t adc2_handle;
 
+// Continuous (DMA) sampling for the ADC1-backed knobs. The ESP32 DIG
+// controller only streams ADC1, so KNOB1/KNOB2 come out of the DMA ring
+// and the ADC2 knobs stay on oneshot reads (see initKnobs).
+#define ADC_DMA_FRAME_BYTES 256
+#define ADC_DMA_POOL_BYTES 1024
+#define ADC_DMA_SAMPLE_FREQ_HZ 4000  // 2 channels x 2kHz, plenty for knobs
+static adc_continuous_handle_t adc_dma_handle = NULL;
+static volatile int dma_filtered[NUM_KNOBS];    // Decimated raw value per DMA-backed knob
+static bool dma_backed[NUM_KNOBS] = {false};    // True if knob is served by the DMA stream
+static int8_t adc1_chan_to_knob[SOC_ADC_CHANNEL_NUM(0)];  // Reverse lookup for result parsing
+
+// Drain whatever conversions the DMA engine has completed (never blocks)
+// and fold them into dma_filtered with a simple per-frame average.
+static void drainAdcDma(void) {
+    if (adc_dma_handle == NULL) return;
+
+    uint8_t frame[ADC_DMA_FRAME_BYTES];
+    uint32_t got = 0;
+    uint32_t sum[SOC_ADC_CHANNEL_NUM(0)] = {0};
+    uint32_t cnt[SOC_ADC_CHANNEL_NUM(0)] = {0};
+
+    while (adc_continuous_read(adc_dma_handle, frame, sizeof(frame), &got, 0) == ESP_OK) {
+        for (uint32_t off = 0; off < got; off += SOC_ADC_DIGI_RESULT_BYTES) {
+            adc_digi_output_data_t *r = (adc_digi_output_data_t *)&frame[off];
+            uint32_t chan = r->type1.channel;
+            if (chan < SOC_ADC_CHANNEL_NUM(0)) {
+                sum[chan] += r->type1.data;
+                cnt[chan]++;
+            }
+        }
+        if (got < sizeof(frame)) break;  // Ring drained
+    }
+
+    for (uint32_t chan = 0; chan < SOC_ADC_CHANNEL_NUM(0); chan++) {
+        if (cnt[chan] == 0) continue;
+        int8_t knob = adc1_chan_to_knob[chan];
+        if (knob >= 0) {
+            dma_filtered[knob] = (int)(sum[chan] / cnt[chan]);
+        }
+    }
+}
+
+static void initAdcDma(void) {
+    adc_digi_pattern_config_t pattern[SOC_ADC_PATT_LEN_MAX];
+    uint32_t pattern_num = 0;
+
+    memset(adc1_chan_to_knob, -1, sizeof(adc1_chan_to_knob));
+    for (int i = 0; i < NUM_KNOBS; i++) {
+        if (adc_configs[i].gpio == 0 || adc_configs[i].handle != adc1_handle) continue;
+        pattern[pattern_num].atten = ADC_ATTEN_DB_12;
+        pattern[pattern_num].channel = adc_configs[i].channel;
+        pattern[pattern_num].unit = ADC_UNIT_1;
+        pattern[pattern_num].bit_width = ADC_BITWIDTH_12;
+        adc1_chan_to_knob[adc_configs[i].channel] = (int8_t)i;
+        dma_backed[i] = true;
+        dma_filtered[i] = 2048;  // Mid until the first frame lands
+        pattern_num++;
+    }
+    if (pattern_num == 0) return;
+
+    adc_continuous_handle_cfg_t handle_cfg = {
+        .max_store_buf_size = ADC_DMA_POOL_BYTES,
+        .conv_frame_size = ADC_DMA_FRAME_BYTES,
+    };
+    ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_cfg, &adc_dma_handle));
+
+    adc_continuous_config_t dma_cfg = {
+        .pattern_num = pattern_num,
+        .adc_pattern = pattern,
+        .sample_freq_hz = ADC_DMA_SAMPLE_FREQ_HZ,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+    };
+    ESP_ERROR_CHECK(adc_continuous_config(adc_dma_handle, &dma_cfg));
+    ESP_ERROR_CHECK(adc_continuous_start(adc_dma_handle));
+    ESP_LOGI(TAG, "ADC DMA streaming %lu ADC1 channel(s)", (unsigned long)pattern_num);
+}
+
 // Per-knob param pointers (NULL if not registered)
 static volatile float* knob_params[NUM_KNOBS] = {NULL};
 
-static uint16_t readButtonRegister(void) {
+// Shift-register I/O rides the SPI2 peripheral instead of bit-banged
+// GPIO: the 74HC165 button chain (PIN_QH = MISO) and 74HC595 LED chain
+// (PIN_MOSI) share PIN_CLK as SCLK, and the latch pins stay plain GPIO
+// pulsed around the transactions. Transfers are 2/4 bytes, which fit
+// the peripheral's own FIFO (SPI_TRANS_USE_*DATA), so a queued
+// transaction costs setup only — the clocking happens while the knob
+// scan runs.
+#define SHIFT_SPI_HOST SPI2_HOST
+#define SHIFT_SPI_CLK_HZ (2 * 1000 * 1000)
+
+static spi_device_handle_t spi165_dev;  // Button chain (read)
+static spi_device_handle_t spi595_dev;  // LED chain (write)
+static spi_transaction_t btn_trans;
+static spi_transaction_t led_trans;
+static bool led_write_pending = false;
+
+static void initShiftSpi(void) {
+    spi_bus_config_t bus_cfg = {
+        .mosi_io_num = PIN_MOSI,
+        .miso_io_num = PIN_QH,
+        .sclk_io_num = PIN_CLK,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+    };
+    ESP_ERROR_CHECK(spi_bus_initialize(SHIFT_SPI_HOST, &bus_cfg, SPI_DMA_CH_AUTO));
+
+    spi_device_interface_config_t dev_cfg = {
+        .mode = 0,  // Both chains shift on the rising clock edge
+        .clock_speed_hz = SHIFT_SPI_CLK_HZ,
+        .spics_io_num = -1,  // Latches are driven manually
+        .queue_size = 1,
+    };
+    ESP_ERROR_CHECK(spi_bus_add_device(SHIFT_SPI_HOST, &dev_cfg, &spi165_dev));
+    ESP_ERROR_CHECK(spi_bus_add_device(SHIFT_SPI_HOST, &dev_cfg, &spi595_dev));
+}
+
+// Parallel-load the 74HC165 chain and queue the 16-bit read; the SPI
+// engine clocks it out while the caller does other work.
+static void startButtonRead(void) {
     gpio_set_level(PIN_SHLD, 0);
-    gpio_set_level(PIN_CLK, 0);
-    gpio_set_level(PIN_CLK, 1);
     gpio_set_level(PIN_SHLD, 1);
+    memset(&btn_trans, 0, sizeof(btn_trans));
+    btn_trans.length = BUTTONSCOUNT;  // Bits
+    btn_trans.flags = SPI_TRANS_USE_RXDATA;
+    ESP_ERROR_CHECK(spi_device_queue_trans(spi165_dev, &btn_trans, portMAX_DELAY));
+}
+
+static uint16_t finishButtonRead(void) {
+    spi_transaction_t *done;
+    ESP_ERROR_CHECK(spi_device_get_trans_result(spi165_dev, &done, portMAX_DELAY));
+    // First bit clocked in is button 0; SPI packs bits MSB-first per byte
     uint16_t switch_value = 0;
     for (int i = 0; i < BUTTONSCOUNT; i++) {
-        if (gpio_get_level(PIN_QH)) {
+        if (btn_trans.rx_data[i / 8] & (0x80 >> (i % 8))) {
             switch_value |= (1 << i);
         }
-        gpio_set_level(PIN_CLK, 0);
-        gpio_set_level(PIN_CLK, 1);
     }
     return switch_value;
 }
 
-static void pollButtons(void) {
+// Latch the previous LED write once its transaction has finished.
+// wait=0 polls; shiftOutRegister passes portMAX_DELAY to order writes.
+static void finishLedWrite(TickType_t wait) {
+    if (!led_write_pending) return;
+    spi_transaction_t *done;
+    if (spi_device_get_trans_result(spi595_dev, &done, wait) == ESP_OK) {
+        gpio_set_level(PIN_SET_D, 1);  // 74HC595 RCLK rising edge latches
+        led_write_pending = false;
+    }
+}
+
+// esp_timer task context: just flag the button; pollButtons dispatches
+// on the next tick so callbacks always run on the UI task.
+static void longPressTimerCb(void *arg) {
+    (void)arg;
+    int i = long_press_armed;
+    if (i >= 0 && buttonCurrentStatus[i]) {
+        // Atomic: the UI task drains with an exchange on the other core
+        __atomic_fetch_or(&long_fire_mask, (uint16_t)(1u << i), __ATOMIC_RELEASE);
+    }
+}
+
+static void pollButtons(uint16_t registerValue) {
     if (!g_button_cb) {
         ESP_LOGW(TAG, "No button cb set");  // One-time
         return;
     }
 
     static bool first_poll = true;
-    uint16_t registerValue = readButtonRegister();
     if (first_poll || registerValue != prev_button_state) {
         ESP_LOGI(TAG, "Button reg: 0x%04x", registerValue);
         first_poll = false;
     }
 
+    // Threshold-elapsed long presses, queued by the one-shot timer. The
+    // exchange claims the bits in one step — a separate read-then-clear
+    // would drop a press the timer lands between the two.
+    uint16_t fire = __atomic_exchange_n(&long_fire_mask, 0, __ATOMIC_ACQUIRE);
+    if (fire) {
+        for (int i = 0; i < BUTTONSCOUNT; i++) {
+            if (fire & (1u << i)) {
+                longPressDetected[i] = true;
+                g_button_cb((uint8_t)(i + 1), LONG_PRESS);
+            }
+        }
+    }
+
+    // No edges since last tick: skip the per-button scan entirely
+    if (registerValue == prev_button_state) return;
+
     for (int i = 0; i < BUTTONSCOUNT; i++) {
         buttonCurrentStatus[i] = (registerValue >> i) & 0x01;
 
         if (buttonCurrentStatus[i] && !buttonLastStatus[i]) {  // Press edge
             timerStart[i] = esp_timer_get_time();
+            if (long_press_timer) {
+                esp_timer_stop(long_press_timer);  // Re-arm for the newest press
+                long_press_armed = i;
+                ESP_ERROR_CHECK(esp_timer_start_once(long_press_timer, LONG_PRESS_THRESHOLD_US));
+            }
         }
 
         if (!buttonCurrentStatus[i] && buttonLastStatus[i]) { // Release edge
+            if (long_press_armed == i) {
+                esp_timer_stop(long_press_timer);
+                long_press_armed = -1;
+            }
             pressDuration[i] = esp_timer_get_time() - timerStart[i];
-            if (pressDuration[i] > LONG_PRESS_THRESHOLD_US) {
-                longPressDetected[i] = true;
+            if (longPressDetected[i]) {
+                // Already reported at the threshold; release is silent
+            } else if (pressDuration[i] > LONG_PRESS_THRESHOLD_US) {
+                // Timer lost the race with the release — still a long press
                 g_button_cb((uint8_t)(i + 1), LONG_PRESS);
             } else {
                 g_button_cb((uint8_t)(i + 1), SHORT_PRESS);
@@ -132,34 +344,28 @@ void setUILogLevel(esp_log_level_t level) {
 }
 
 static void initButtons(void) {
+    // PIN_QH and PIN_CLK belong to the SPI bus now; only the latch stays GPIO
     gpio_config_t shld_conf = {
         .intr_type = GPIO_INTR_DISABLE,
         .mode = GPIO_MODE_OUTPUT,
         .pin_bit_mask = (1ULL << PIN_SHLD),
     };
     ESP_ERROR_CHECK(gpio_config(&shld_conf));
+    gpio_set_level(PIN_SHLD, 1);  // Shift mode until a read loads the chain
 
-    gpio_config_t qh_conf = {
-        .intr_type = GPIO_INTR_DISABLE,
-        .mode = GPIO_MODE_INPUT,
-        .pin_bit_mask = (1ULL << PIN_QH),
-        .pull_up_en = GPIO_PULLUP_ENABLE,  // Assuming internal pull-up if no external
+    const esp_timer_create_args_t lp_args = {
+        .callback = longPressTimerCb,
+        .name = "btn_long",
     };
-    ESP_ERROR_CHECK(gpio_config(&qh_conf));
-
-    gpio_config_t clk_conf = {
-        .intr_type = GPIO_INTR_DISABLE,
-        .mode = GPIO_MODE_OUTPUT,
-        .pin_bit_mask = (1ULL << PIN_CLK),
-    };
-    ESP_ERROR_CHECK(gpio_config(&clk_conf));
+    ESP_ERROR_CHECK(esp_timer_create(&lp_args, &long_press_timer));
 }
 
 static void initLEDs(void) {
+    // PIN_MOSI belongs to the SPI bus; only the latch stays GPIO
     gpio_config_t io_conf = {
         .intr_type = GPIO_INTR_DISABLE,
         .mode = GPIO_MODE_OUTPUT,
-        .pin_bit_mask = (1ULL << PIN_MOSI) | (1ULL << PIN_SET_D),
+        .pin_bit_mask = (1ULL << PIN_SET_D),
     };
     ESP_ERROR_CHECK(gpio_config(&io_conf));
 
@@ -167,11 +373,10 @@ static void initLEDs(void) {
 }
 
 static void initKnobs(void) {
-    adc_oneshot_unit_init_cfg_t adc1_cfg = {
-        .unit_id = ADC_UNIT_1,
-        .ulp_mode = ADC_ULP_MODE_DISABLE,
-    };
-    ESP_ERROR_CHECK(adc_oneshot_new_unit(&adc1_cfg, &adc1_handle));
+    // adc1_handle stays as a marker for "ADC1 knob" in adc_configs; the
+    // actual ADC1 sampling is done by the continuous (DMA) driver below,
+    // so no oneshot unit is created for it.
+    adc1_handle = (adc_oneshot_unit_handle_t)&adc1_handle;
 
     adc_oneshot_unit_init_cfg_t adc2_cfg = {
         .unit_id = ADC_UNIT_2,
@@ -186,18 +391,35 @@ static void initKnobs(void) {
     for (int i = 0; i < NUM_KNOBS; i++) {
         if (adc_configs[i].gpio == 0) continue;  // Skip virtual if not configured
         adc_configs[i].handle = (i < 2) ? adc1_handle : adc2_handle;  // Fixed: KNOB1/2 on ADC1, KNOB3+ on ADC2
-        ESP_ERROR_CHECK(adc_oneshot_config_channel(adc_configs[i].handle, adc_configs[i].channel, &chan_cfg));
+        if (adc_configs[i].handle == adc2_handle) {
+            ESP_ERROR_CHECK(adc_oneshot_config_channel(adc_configs[i].handle, adc_configs[i].channel, &chan_cfg));
+        }
     }
+
+    initAdcDma();
+    drainAdcDma();  // Prime the filtered values before the baseline reads
     // Initial read to set baseline for registered knobs
     for (int i = 0; i < NUM_KNOBS; i++) {
-        if (knob_params[i]) {
+        if (knob_registered[i]) {
             float init_val = readKnob(i);
+            if (init_val >= 0.0f) {
+                current_knob_values[i] = init_val;
+            }
             ESP_LOGI(TAG, "Initial read for knob %d: %.2f", i, init_val);
         }
     }
+    parambox_publish(&knobBox, current_knob_values, NUM_KNOBS);  // Baseline snapshot
 }
 
 void initUI(void) {
+    // Patch state comes back before anything reads it; no-ops if the
+    // binary never called patchsave_init (hwTest).
+    patchsave_region("knob_saved", saved_knob_values, sizeof(saved_knob_values));
+    patchsave_region("knob_chase", isChasing, sizeof(isChasing));
+    patchsave_region("mkmap", multi_knob_map, sizeof(multi_knob_map));
+    rebuildMultiKnobLut();  // Pick up restored mappings
+
+    initShiftSpi();
     initButtons();
     initLEDs();
     initKnobs();
@@ -210,7 +432,9 @@ float readKnob(knob_index_t knobNum) {
     }
 
     int raw;
-    if (adc_oneshot_read(adc_configs[knobNum].handle, adc_configs[knobNum].channel, &raw) != ESP_OK) {
+    if (dma_backed[knobNum]) {
+        raw = dma_filtered[knobNum];  // Latest DMA-decimated value, no blocking read
+    } else if (adc_oneshot_read(adc_configs[knobNum].handle, adc_configs[knobNum].channel, &raw) != ESP_OK) {
         ESP_LOGE(TAG, "ADC read failed for knob %d", knobNum);
         return -1.0f;
     }
@@ -218,12 +442,9 @@ float readKnob(knob_index_t knobNum) {
 
     float norm = (4095.0f - (float)raw) / 4095.0f;  // Inverted, normalized 0-1
     uint8_t mode = 0;
-    for (int i = 0; i < NUM_KNOBS; i++) {
-        if (multi_knob_map[i].phys_knob == knobNum && multi_knob_map[i].btn != 0 && isButtonPressed(multi_knob_map[i].btn)) {
-            mode = 1;
-            knobNum = multi_knob_map[i].virt_knob;
-            break;
-        }
+    if (mk_btn[knobNum] != 0 && isButtonPressed(mk_btn[knobNum])) {  // Precomputed, no map walk
+        mode = 1;
+        knobNum = mk_virt[knobNum];
     }
 
     if (isChasing[knobNum][mode]) {
@@ -259,6 +480,7 @@ void setKnobSavedValue(knob_index_t knobNum, float value, uint8_t mode, bool ena
         }
     }
     ESP_LOGI(TAG, "Knob %d (mode %d) saved: %.2f, chasing %s", knobNum, mode, saved_knob_values[knobNum][mode], enable_chase ? "enabled" : "disabled");
+    patchsave_mark_dirty();
 }
 
 void setKnobParam(knob_index_t knobNum, volatile float* paramPtr) {
@@ -266,8 +488,13 @@ void setKnobParam(knob_index_t knobNum, volatile float* paramPtr) {
         ESP_LOGE(TAG, "Invalid knob %d", knobNum);
         return;
     }
-    knob_params[knobNum] = paramPtr;
-    ESP_LOGI(TAG, "Param pointer registered for knob %d at %p", knobNum, (void*)paramPtr);
+    knob_params[knobNum] = paramPtr;  // May be NULL: scan the knob, publish via knobBox only
+    if (!knob_registered[knobNum]) {
+        knob_registered[knobNum] = true;
+        scan_list[scan_count++] = knobNum;        // Dense schedule for the tick loop
+        knob_hot[knobNum] = KNOB_HOT_TICKS;       // Sample every tick until it settles
+    }
+    ESP_LOGI(TAG, "Knob %d registered (param ptr %p)", knobNum, (void*)paramPtr);
 }
 
 void initMultiKnob(knob_index_t phys_knob, knob_index_t virt_knob, uint8_t btn) {
@@ -284,20 +511,26 @@ void initMultiKnob(knob_index_t phys_knob, knob_index_t virt_knob, uint8_t btn)
             multi_knob_map[i].phys_knob = phys_knob;
             multi_knob_map[i].virt_knob = virt_knob;
             multi_knob_map[i].btn = btn;
+            rebuildMultiKnobLut();
             ESP_LOGI(TAG, "Multi-knob %d mapped to virtual %d with btn=%d", phys_knob + 1, virt_knob + 1, btn);
+            patchsave_mark_dirty();
             break;
         }
     }
 }
 
 void shiftOutRegister(uint32_t bits_value) {
-    gpio_set_level(PIN_SET_D, 0);  // Clear shift register
-    for (int i = 31; i >= 0; i--) {
-        gpio_set_level(PIN_CLK, 0);
-        gpio_set_level(PIN_MOSI, (bits_value & (1U << i)) ? 1 : 0);  // Inverted for common anode
-        gpio_set_level(PIN_CLK, 1);
-    }
-    gpio_set_level(PIN_SET_D, 1);  // Latch
+    finishLedWrite(portMAX_DELAY);  // Previous write must latch before reuse
+    gpio_set_level(PIN_SET_D, 0);   // Latch low while the new pattern shifts
+    memset(&led_trans, 0, sizeof(led_trans));
+    led_trans.length = 32;  // Bits, MSB first — same order as the old bit-bang
+    led_trans.flags = SPI_TRANS_USE_TXDATA;
+    led_trans.tx_data[0] = (uint8_t)(bits_value >> 24);
+    led_trans.tx_data[1] = (uint8_t)(bits_value >> 16);
+    led_trans.tx_data[2] = (uint8_t)(bits_value >> 8);
+    led_trans.tx_data[3] = (uint8_t)bits_value;
+    ESP_ERROR_CHECK(spi_device_queue_trans(spi595_dev, &led_trans, portMAX_DELAY));
+    led_write_pending = true;  // Latched by finishLedWrite next tick
 }
 
 void setLedState(uint8_t ledNum, led_state_t state) {
@@ -435,12 +668,26 @@ void updateUITask(void *pvParameters) {
     static float last_knob_values[NUM_KNOBS] = { -1.0f };  // For change detection
 
     while (1) {
-        // Poll buttons first
-        pollButtons();
-
-        // Poll only registered knobs
-        for (knob_index_t i = 0; i < NUM_KNOBS; i++) {
-            if (knob_params[i] == NULL) continue;  // Skip unregistered
+        perfmon_begin(PERF_STAGE_UI_POLL);
+        finishLedWrite(0);  // Latch the LED pattern queued last tick, if done
+
+        // Kick off the button shift-in, overlap it with the ADC drain,
+        // then collect — the SPI clocks run while we do useful work.
+        startButtonRead();
+        drainAdcDma();  // Fold completed DMA conversions into the filtered knob values
+        pollButtons(finishButtonRead());
+
+        // Poll the dense scan list: hot knobs every tick, idle knobs at
+        // 1/8 rate (staggered by slot so they spread across ticks).
+        static uint32_t tick_count = 0;
+        tick_count++;
+        bool any_changed = false;
+        for (int s = 0; s < scan_count; s++) {
+            knob_index_t i = scan_list[s];
+            if (knob_hot[i] == 0 &&
+                (tick_count & (KNOB_IDLE_DIV - 1)) != ((uint32_t)s & (KNOB_IDLE_DIV - 1))) {
+                continue;  // Idle knob, not its tick
+            }
 
             float val = readKnob(i);
             if (val < 0.0f) {
@@ -450,13 +697,24 @@ void updateUITask(void *pvParameters) {
 
             ESP_LOGD(TAG, "Knob %d checked: val %.2f, last %.2f", i, val, last_knob_values[i]);  // LOGD to reduce spam
             if (fabs(val - last_knob_values[i]) > (HYSTERESIS_THRESHOLD / 4095.0f)) {  // Increased to 30 for noise filter
-                ESP_LOGI(TAG, "Knob %d raw value changed to %.2f", i, val);  // LOGI for changes
+                dlog_write("UI: knob %.0f changed to %.2f", (float)i, val, 0, 0);  // Deferred; a turn fires every tick
                 last_knob_values[i] = val;
-                *knob_params[i] = val;  // Direct update
-                knobsUpdated = 1;
-                ESP_LOGI(TAG, "Knob %d param updated to %.2f", i, val);  // LOGI for updates
+                current_knob_values[i] = val;
+                if (knob_params[i]) {
+                    *knob_params[i] = val;  // Legacy direct update
+                }
+                any_changed = true;
+                knob_hot[i] = KNOB_HOT_TICKS;  // Keep sampling every tick while it moves
+            } else if (knob_hot[i] > 0) {
+                knob_hot[i]--;  // Settling: drop to idle rate after the hot window
             }
         }
+        if (any_changed) {
+            // One consistent snapshot per tick; consumers compare the
+            // generation from parambox_read instead of the old flag.
+            parambox_publish(&knobBox, current_knob_values, NUM_KNOBS);
+            knobsUpdated = 1;  // Legacy flag for code not yet on knobBox
+        }
 
 
         uint32_t led_bits = 0;
@@ -478,6 +736,7 @@ void updateUITask(void *pvParameters) {
             shiftOutRegister(led_bits);
             last_led_bits = led_bits;
         }
+        perfmon_end(PERF_STAGE_UI_POLL);
 
         vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(UI_UPDATE_INTERVAL_MS));
     }
@@ -2,6 +2,7 @@
 #define UI_H
 
 #include <stdint.h>
+#include "parambox.h"
 #include "driver/gpio.h"
 #include "esp_adc/adc_oneshot.h"
 #include "freertos/FreeRTOS.h"
@@ -139,7 +140,14 @@ void setButtonCallback(button_callback_t cb);
  */
 bool isButtonPressed(uint8_t btnNum);
 
-extern volatile uint8_t knobsUpdated;  // Flag set when any knob changes
+extern volatile uint8_t knobsUpdated;  // Flag set when any knob changes (legacy; prefer knobBox)
+
+/**
+ * Seqlock mailbox carrying a consistent snapshot of all knob values,
+ * indexed by knob_index_t. Audio tasks call parambox_read() once per
+ * block and recompute only when the returned generation changes.
+ */
+extern parambox_t knobBox;
 
 #ifdef __cplusplus
 }
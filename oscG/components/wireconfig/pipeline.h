@@ -0,0 +1,51 @@
+#pragma once
+#include <stddef.h>
+#include "wireconfig.h"
+
+namespace dms {
+
+/**
+ * Compile-time pipeline configuration for the block mix loops.
+ *
+ * Block size and voice count are template arguments, so the inner loops
+ * have known trip counts the compiler can unroll, and the voice
+ * normalization is a reciprocal multiply folded at compile time instead
+ * of the per-sample divide the open-coded loops used. Both binaries
+ * instantiate this once per pipeline; trialing a different block size
+ * means changing one template argument (plus WIRE_BLOCK_SIZE for the
+ * wire format).
+ */
+template <int kBlockSize, int kNumVoices = 1>
+struct Pipeline {
+    static constexpr int kPacketBytes = kBlockSize * WIRE_BYTES_PER_SAMPLE;
+    static constexpr float kVoiceNorm = 1.0f / static_cast<float>(kNumVoices);
+
+    // asor's cloud mixdown: normalize by voice count, clamp with
+    // headroom, apply the post-mix gain. One multiply per sample where
+    // the old loop divided.
+    static inline void CloudMixdown(float* block, float gain) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            float v = block[i] * kVoiceNorm;
+            if (v > 1.0f) v = 1.0f;
+            if (v < -1.0f) v = -1.0f;
+            block[i] = v * gain;
+        }
+    }
+
+    // oscG's balance blend of two rendered voices
+    static inline void Blend(float* out, const float* a, const float* b,
+                             float wa, float wb) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            out[i] = wa * a[i] + wb * b[i];
+        }
+    }
+
+    // Fold a secondary stream (e.g. the received mix) into the block
+    static inline void MixIn(float* out, const float* in, float gain) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            out[i] += gain * in[i];
+        }
+    }
+};
+
+}  // namespace dms
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * Single source of truth for the wire-format constants.
+ *
+ * Every sender, receiver, and tool that touches the audio stream agrees
+ * on these numbers: main.cpp and asor.cpp define their local names from
+ * them, and audioRecv.py mirrors them by hand (kept in sync by the
+ * comment there pointing back at this file). Changing the block size for
+ * a 48- or 192-sample trial is a one-line edit here.
+ *
+ * Freestanding — no ESP includes — so host tools compile against it.
+ */
+
+#define WIRE_SAMPLE_RATE 48000
+#define WIRE_BLOCK_SIZE 96
+#define WIRE_BYTES_PER_SAMPLE 3  // L24BE on the wire
+#define WIRE_PACKET_SIZE (WIRE_BLOCK_SIZE * WIRE_BYTES_PER_SAMPLE)
+#define WIRE_AUDIO_PORT 5005  // Control streams use CTLSTREAM_PORT (5006)
+
+/**
+ * @brief Audio stream group for a module, from the low two octets of its
+ *        unicast IP — the 239.100.x.y scheme the binaries used to
+ *        open-code. Returns the group in host order (htonl before use in
+ *        a sockaddr or lwIP address).
+ */
+static inline uint32_t wire_audio_group(uint8_t ip_oct2, uint8_t ip_oct3) {
+    return (239u << 24) | (100u << 16) | ((uint32_t)ip_oct2 << 8) | ip_oct3;
+}
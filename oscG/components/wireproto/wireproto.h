@@ -0,0 +1,79 @@
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Wire header for the audio multicast streams.
+ *
+ * 42 bytes of Ethernet/IP/UDP per bare 288-byte block is mostly header
+ * overhead at 500 packets/s/module, and per-packet lwIP cost dominates
+ * at the receiver. This header lets a sender pack 1-4 consecutive
+ * 96-sample blocks into one datagram: latency-sensitive audio keeps
+ * nblocks=1, utility streams (LFOs, envelopes) batch aggressively.
+ * v2 adds a 32-bit sample clock so receivers can reorder out-of-order
+ * datagrams and tell a lost packet from a late one.
+ *
+ * Receivers (audioRecv.py and receiver_task) accept both this format and
+ * legacy bare 288-byte datagrams, telling them apart by length + magic.
+ */
+#define WIREPROTO_MAGIC 0x444D   // "DM"
+#define WIREPROTO_VERSION 2
+#define WIREPROTO_MAX_BLOCKS 4
+#define WIREPROTO_BLOCK_BYTES 288  // 96 samples x 24-bit
+#define WIREPROTO_HDR_V1_BYTES 8   // v1 had no sample clock
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;        // WIREPROTO_MAGIC, little-endian on the wire
+    uint8_t version;       // WIREPROTO_VERSION
+    uint8_t nblocks;       // 96-sample blocks following this header (1-4)
+    uint32_t seq;          // Datagram sequence number, little-endian
+    uint32_t sample_clock; // v2+: sender sample index of the first sample in
+                           // the first block (48kHz, wraps every ~24.8h)
+} wireproto_hdr_t;
+
+#ifdef __cplusplus
+static_assert(sizeof(wireproto_hdr_t) == 12, "wire header must stay 12 bytes");
+#else
+_Static_assert(sizeof(wireproto_hdr_t) == 12, "wire header must stay 12 bytes");
+#endif
+
+/**
+ * @brief Fill in a v2 header in-place.
+ */
+static inline void wireproto_write_hdr(wireproto_hdr_t *hdr, uint8_t nblocks,
+                                       uint32_t seq, uint32_t sample_clock) {
+    hdr->magic = WIREPROTO_MAGIC;
+    hdr->version = WIREPROTO_VERSION;
+    hdr->nblocks = nblocks;
+    hdr->seq = seq;
+    hdr->sample_clock = sample_clock;
+}
+
+/**
+ * @brief Validate a received header against the datagram length.
+ *
+ * Accepts both the current v2 format and 8-byte v1 headers from older
+ * firmware; the block payload starts *hdr_bytes into the datagram, and
+ * hdr->sample_clock is only valid when *hdr_bytes == sizeof(wireproto_hdr_t).
+ *
+ * @return Number of blocks, or 0 if this is not a valid datagram.
+ */
+static inline int wireproto_parse_hdr(const wireproto_hdr_t *hdr, int datagram_len,
+                                      int *hdr_bytes) {
+    if (hdr->magic != WIREPROTO_MAGIC) return 0;
+    int hb;
+    if (hdr->version == 1) hb = WIREPROTO_HDR_V1_BYTES;
+    else if (hdr->version == WIREPROTO_VERSION) hb = (int)sizeof(wireproto_hdr_t);
+    else return 0;
+    if (hdr->nblocks < 1 || hdr->nblocks > WIREPROTO_MAX_BLOCKS) return 0;
+    if (datagram_len != hb + hdr->nblocks * WIREPROTO_BLOCK_BYTES) return 0;
+    if (hdr_bytes) *hdr_bytes = hb;
+    return hdr->nblocks;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Generate band-limited mipmapped saw tables for wtosc.
+
+Writes wtosc_tables.c: one 257-entry int16 table per octave, each
+additively synthesized with only the harmonics that stay below Nyquist
+for the octave's top fundamental. Run from this directory after changing
+the constants below; the generated file is committed so builds don't
+need Python.
+"""
+import math
+
+SAMPLE_RATE = 48000
+TABLE_SIZE = 256       # Power of two; +1 guard entry for interpolation
+NUM_TABLES = 10        # Octaves from BOTTOM_FREQ up (20Hz .. ~20kHz)
+BOTTOM_FREQ = 20.0
+
+
+def saw_table(num_harmonics):
+    out = []
+    for i in range(TABLE_SIZE):
+        x = i / TABLE_SIZE
+        s = 0.0
+        for k in range(1, num_harmonics + 1):
+            s += ((-1) ** (k + 1)) * math.sin(2.0 * math.pi * k * x) / k
+        out.append(s * 2.0 / math.pi)
+    peak = max(abs(v) for v in out) or 1.0
+    return [v / peak for v in out]
+
+
+def main():
+    with open("wtosc_tables.c", "w") as f:
+        f.write("// Generated by gen_tables.py — do not edit by hand.\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("#define WT_NUM_TABLES %d\n" % NUM_TABLES)
+        f.write("#define WT_TABLE_SIZE %d\n\n" % TABLE_SIZE)
+        f.write("// Top fundamental each table serves alias-free\n")
+        f.write("const float wt_table_top_freq[WT_NUM_TABLES] = {\n    ")
+        tops = [BOTTOM_FREQ * (2 ** (o + 1)) for o in range(NUM_TABLES)]
+        f.write(", ".join("%.1ff" % t for t in tops))
+        f.write("\n};\n\n")
+        f.write("const int16_t wt_saw_tables[WT_NUM_TABLES][WT_TABLE_SIZE + 1] = {\n")
+        for o in range(NUM_TABLES):
+            nh = max(1, min(TABLE_SIZE // 2 - 1, int((SAMPLE_RATE / 2.0) / tops[o])))
+            tab = saw_table(nh)
+            tab.append(tab[0])  # Guard entry: wraps to the start
+            f.write("    // Octave %d: top %.0fHz, %d harmonics\n" % (o, tops[o], nh))
+            f.write("    {")
+            for i, v in enumerate(tab):
+                if i % 12 == 0:
+                    f.write("\n        ")
+                f.write("%d, " % int(round(v * 32767)))
+            f.write("\n    },\n")
+        f.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
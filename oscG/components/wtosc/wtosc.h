@@ -0,0 +1,123 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+namespace dms {  // Digital Modular Synth namespace
+
+// Band-limited tables generated offline by gen_tables.py; const, so the
+// linker places them in flash rodata. One table per octave, 256 samples
+// plus a guard entry for interpolation.
+static const int kWtNumTables = 10;
+static const int kWtTableSize = 256;
+
+extern "C" {
+extern const float wt_table_top_freq[10];
+extern const int16_t wt_saw_tables[10][257];
+}
+
+/**
+ * Mipmapped wavetable oscillator.
+ *
+ * Drop-in for the daisysp::Oscillator usage in the senders: same
+ * Init/SetWaveform/SetFreq/SetPw/SetAmp/Process surface. Table selection
+ * happens in SetFreq (octave mip pick, so high notes use tables with few
+ * harmonics and don't alias); the only per-sample work is a 32-bit phase
+ * add and one linearly interpolated table read. Square/pulse is the
+ * difference of two saw reads offset by the pulse width, which keeps it
+ * band-limited for free and makes SetPw continuous.
+ */
+class WavetableOscillator {
+public:
+    enum Waveform { WAVE_SAW, WAVE_SQUARE };
+
+    WavetableOscillator()
+        : phase_(0), phase_inc_(0), table_(0), waveform_(WAVE_SAW),
+          pw_offset_(0x80000000u), dc_comp_(0.0f), amp_(1.0f), sample_rate_(48000.0f) {}
+
+    void Init(float sample_rate) {
+        sample_rate_ = sample_rate;
+        phase_ = 0;
+        SetFreq(440.0f);
+    }
+
+    inline void SetWaveform(Waveform wf) { waveform_ = wf; }
+
+    inline void SetFreq(float freq) {
+        float ratio = freq / sample_rate_;
+        if (ratio < 0.0f) ratio = 0.0f;
+        if (ratio > 0.5f) ratio = 0.5f;
+        phase_inc_ = (uint32_t)(ratio * 4294967296.0f);
+        // Mip pick: first table whose alias-free top covers this freq
+        int t = 0;
+        while (t < kWtNumTables - 1 && freq > wt_table_top_freq[t]) t++;
+        table_ = t;
+    }
+
+    inline void SetPw(float pw) {
+        if (pw < 0.05f) pw = 0.05f;
+        if (pw > 0.95f) pw = 0.95f;
+        pw_offset_ = (uint32_t)(pw * 4294967296.0f);
+        dc_comp_ = 2.0f * pw - 1.0f;  // Re-center the saw difference
+    }
+
+    inline void SetAmp(float amp) { amp_ = amp; }
+
+    inline float Process() {
+        float out;
+        if (waveform_ == WAVE_SQUARE) {
+            // Band-limited pulse: saw(phase) - saw(phase + pw) + DC
+            out = ReadSaw(phase_) - ReadSaw(phase_ + pw_offset_) + dc_comp_;
+        } else {
+            out = ReadSaw(phase_);
+        }
+        phase_ += phase_inc_;
+        return out * amp_;
+    }
+
+    // Block variant: state in registers, one pass over the buffer.
+    void RenderBlock(float* out, size_t size) {
+        uint32_t phase = phase_;
+        const uint32_t inc = phase_inc_;
+        const int16_t* tab = wt_saw_tables[table_];
+        if (waveform_ == WAVE_SQUARE) {
+            const uint32_t pw = pw_offset_;
+            const float dc = dc_comp_ * amp_;
+            const float amp = amp_;
+            for (size_t i = 0; i < size; ++i) {
+                out[i] = (Lookup(tab, phase) - Lookup(tab, phase + pw)) * amp + dc;
+                phase += inc;
+            }
+        } else {
+            const float amp = amp_;
+            for (size_t i = 0; i < size; ++i) {
+                out[i] = Lookup(tab, phase) * amp;
+                phase += inc;
+            }
+        }
+        phase_ = phase;
+    }
+
+private:
+    static inline float Lookup(const int16_t* tab, uint32_t phase) {
+        uint32_t idx = phase >> 24;  // 32 - log2(kWtTableSize)
+        int32_t frac = (phase >> 8) & 0xFFFF;
+        int32_t s0 = tab[idx];
+        int32_t s1 = tab[idx + 1];
+        return (float)(s0 + (((s1 - s0) * frac) >> 16)) * (1.0f / 32767.0f);
+    }
+
+    inline float ReadSaw(uint32_t phase) const {
+        return Lookup(wt_saw_tables[table_], phase);
+    }
+
+    uint32_t phase_;      // Q0.32 phase accumulator
+    uint32_t phase_inc_;
+    int table_;           // Current mip level
+    Waveform waveform_;
+    uint32_t pw_offset_;  // Pulse width as phase offset
+    float dc_comp_;
+    float amp_;
+    float sample_rate_;
+};
+
+}  // namespace dms
@@ -0,0 +1,263 @@
+// Generated by gen_tables.py — do not edit by hand.
+#include <stdint.h>
+
+#define WT_NUM_TABLES 10
+#define WT_TABLE_SIZE 256
+
+// Top fundamental each table serves alias-free
+const float wt_table_top_freq[WT_NUM_TABLES] = {
+    40.0f, 80.0f, 160.0f, 320.0f, 640.0f, 1280.0f, 2560.0f, 5120.0f, 10240.0f, 20480.0f
+};
+
+const int16_t wt_saw_tables[WT_NUM_TABLES][WT_TABLE_SIZE + 1] = {
+    // Octave 0: top 40Hz, 127 harmonics
+    {
+        0, 219, 435, 658, 871, 1097, 1306, 1536, 1742, 1975, 2177, 2414, 
+        2613, 2853, 3048, 3292, 3483, 3731, 3919, 4170, 4354, 4609, 4790, 5048, 
+        5225, 5487, 5660, 5926, 6095, 6365, 6531, 6804, 6966, 7243, 7401, 7682, 
+        7836, 8121, 8271, 8561, 8706, 9000, 9141, 9440, 9576, 9879, 10011, 10319, 
+        10445, 10758, 10880, 11198, 11315, 11638, 11749, 12078, 12183, 12518, 12618, 12958, 
+        13052, 13398, 13486, 13838, 13920, 14279, 14353, 14720, 14787, 15161, 15220, 15602, 
+        15653, 16043, 16086, 16485, 16518, 16927, 16951, 17369, 17382, 17812, 17814, 18255, 
+        18245, 18699, 18675, 19143, 19105, 19588, 19534, 20033, 19962, 20480, 20390, 20927, 
+        20816, 21376, 21241, 21827, 21664, 22279, 22085, 22733, 22503, 23191, 22918, 23652, 
+        23329, 24118, 23734, 24591, 24132, 25073, 24518, 25569, 24887, 26085, 25230, 26637, 
+        25525, 27253, 25729, 28009, 25705, 29174, 24823, 32767, 0, -32767, -24823, -29174, 
+        -25705, -28009, -25729, -27253, -25525, -26637, -25230, -26085, -24887, -25569, -24518, -25073, 
+        -24132, -24591, -23734, -24118, -23329, -23652, -22918, -23191, -22503, -22733, -22085, -22279, 
+        -21664, -21827, -21241, -21376, -20816, -20927, -20390, -20480, -19962, -20033, -19534, -19588, 
+        -19105, -19143, -18675, -18699, -18245, -18255, -17814, -17812, -17382, -17369, -16951, -16927, 
+        -16518, -16485, -16086, -16043, -15653, -15602, -15220, -15161, -14787, -14720, -14353, -14279, 
+        -13920, -13838, -13486, -13398, -13052, -12958, -12618, -12518, -12183, -12078, -11749, -11638, 
+        -11315, -11198, -10880, -10758, -10445, -10319, -10011, -9879, -9576, -9440, -9141, -9000, 
+        -8706, -8561, -8271, -8121, -7836, -7682, -7401, -7243, -6966, -6804, -6531, -6365, 
+        -6095, -5926, -5660, -5487, -5225, -5048, -4790, -4609, -4354, -4170, -3919, -3731, 
+        -3483, -3292, -3048, -2853, -2613, -2414, -2177, -1975, -1742, -1536, -1306, -1097, 
+        -871, -658, -435, -219, 0, 
+    },
+    // Octave 1: top 80Hz, 127 harmonics
+    {
+        0, 219, 435, 658, 871, 1097, 1306, 1536, 1742, 1975, 2177, 2414, 
+        2613, 2853, 3048, 3292, 3483, 3731, 3919, 4170, 4354, 4609, 4790, 5048, 
+        5225, 5487, 5660, 5926, 6095, 6365, 6531, 6804, 6966, 7243, 7401, 7682, 
+        7836, 8121, 8271, 8561, 8706, 9000, 9141, 9440, 9576, 9879, 10011, 10319, 
+        10445, 10758, 10880, 11198, 11315, 11638, 11749, 12078, 12183, 12518, 12618, 12958, 
+        13052, 13398, 13486, 13838, 13920, 14279, 14353, 14720, 14787, 15161, 15220, 15602, 
+        15653, 16043, 16086, 16485, 16518, 16927, 16951, 17369, 17382, 17812, 17814, 18255, 
+        18245, 18699, 18675, 19143, 19105, 19588, 19534, 20033, 19962, 20480, 20390, 20927, 
+        20816, 21376, 21241, 21827, 21664, 22279, 22085, 22733, 22503, 23191, 22918, 23652, 
+        23329, 24118, 23734, 24591, 24132, 25073, 24518, 25569, 24887, 26085, 25230, 26637, 
+        25525, 27253, 25729, 28009, 25705, 29174, 24823, 32767, 0, -32767, -24823, -29174, 
+        -25705, -28009, -25729, -27253, -25525, -26637, -25230, -26085, -24887, -25569, -24518, -25073, 
+        -24132, -24591, -23734, -24118, -23329, -23652, -22918, -23191, -22503, -22733, -22085, -22279, 
+        -21664, -21827, -21241, -21376, -20816, -20927, -20390, -20480, -19962, -20033, -19534, -19588, 
+        -19105, -19143, -18675, -18699, -18245, -18255, -17814, -17812, -17382, -17369, -16951, -16927, 
+        -16518, -16485, -16086, -16043, -15653, -15602, -15220, -15161, -14787, -14720, -14353, -14279, 
+        -13920, -13838, -13486, -13398, -13052, -12958, -12618, -12518, -12183, -12078, -11749, -11638, 
+        -11315, -11198, -10880, -10758, -10445, -10319, -10011, -9879, -9576, -9440, -9141, -9000, 
+        -8706, -8561, -8271, -8121, -7836, -7682, -7401, -7243, -6966, -6804, -6531, -6365, 
+        -6095, -5926, -5660, -5487, -5225, -5048, -4790, -4609, -4354, -4170, -3919, -3731, 
+        -3483, -3292, -3048, -2853, -2613, -2414, -2177, -1975, -1742, -1536, -1306, -1097, 
+        -871, -658, -435, -219, 0, 
+    },
+    // Octave 2: top 160Hz, 127 harmonics
+    {
+        0, 219, 435, 658, 871, 1097, 1306, 1536, 1742, 1975, 2177, 2414, 
+        2613, 2853, 3048, 3292, 3483, 3731, 3919, 4170, 4354, 4609, 4790, 5048, 
+        5225, 5487, 5660, 5926, 6095, 6365, 6531, 6804, 6966, 7243, 7401, 7682, 
+        7836, 8121, 8271, 8561, 8706, 9000, 9141, 9440, 9576, 9879, 10011, 10319, 
+        10445, 10758, 10880, 11198, 11315, 11638, 11749, 12078, 12183, 12518, 12618, 12958, 
+        13052, 13398, 13486, 13838, 13920, 14279, 14353, 14720, 14787, 15161, 15220, 15602, 
+        15653, 16043, 16086, 16485, 16518, 16927, 16951, 17369, 17382, 17812, 17814, 18255, 
+        18245, 18699, 18675, 19143, 19105, 19588, 19534, 20033, 19962, 20480, 20390, 20927, 
+        20816, 21376, 21241, 21827, 21664, 22279, 22085, 22733, 22503, 23191, 22918, 23652, 
+        23329, 24118, 23734, 24591, 24132, 25073, 24518, 25569, 24887, 26085, 25230, 26637, 
+        25525, 27253, 25729, 28009, 25705, 29174, 24823, 32767, 0, -32767, -24823, -29174, 
+        -25705, -28009, -25729, -27253, -25525, -26637, -25230, -26085, -24887, -25569, -24518, -25073, 
+        -24132, -24591, -23734, -24118, -23329, -23652, -22918, -23191, -22503, -22733, -22085, -22279, 
+        -21664, -21827, -21241, -21376, -20816, -20927, -20390, -20480, -19962, -20033, -19534, -19588, 
+        -19105, -19143, -18675, -18699, -18245, -18255, -17814, -17812, -17382, -17369, -16951, -16927, 
+        -16518, -16485, -16086, -16043, -15653, -15602, -15220, -15161, -14787, -14720, -14353, -14279, 
+        -13920, -13838, -13486, -13398, -13052, -12958, -12618, -12518, -12183, -12078, -11749, -11638, 
+        -11315, -11198, -10880, -10758, -10445, -10319, -10011, -9879, -9576, -9440, -9141, -9000, 
+        -8706, -8561, -8271, -8121, -7836, -7682, -7401, -7243, -6966, -6804, -6531, -6365, 
+        -6095, -5926, -5660, -5487, -5225, -5048, -4790, -4609, -4354, -4170, -3919, -3731, 
+        -3483, -3292, -3048, -2853, -2613, -2414, -2177, -1975, -1742, -1536, -1306, -1097, 
+        -871, -658, -435, -219, 0, 
+    },
+    // Octave 3: top 320Hz, 75 harmonics
+    {
+        0, 342, 386, 596, 1012, 1147, 1232, 1627, 1898, 1928, 2217, 2603, 
+        2676, 2825, 3247, 3439, 3486, 3844, 4175, 4209, 4435, 4853, 4970, 5063, 
+        5472, 5729, 5751, 6059, 6443, 6497, 6658, 7093, 7266, 7310, 7690, 8013, 
+        8027, 8273, 8700, 8792, 8888, 9322, 9562, 9568, 9902, 10289, 10314, 10488, 
+        10946, 11093, 11126, 11539, 11855, 11839, 12108, 12556, 12612, 12706, 13178, 13399, 
+        13375, 13746, 14145, 14123, 14311, 14811, 14920, 14930, 15396, 15707, 15637, 15942, 
+        16427, 16424, 16511, 17050, 17241, 17162, 17596, 18019, 17916, 18123, 18700, 18745, 
+        18708, 19270, 19578, 19405, 19772, 20333, 20219, 20286, 20959, 21096, 20900, 21461, 
+        21939, 21664, 21909, 22656, 22561, 22413, 23199, 23501, 23078, 23597, 24356, 23951, 
+        23960, 25007, 24989, 24444, 25397, 26059, 25198, 25575, 26968, 26307, 25687, 27508, 
+        27778, 25955, 27452, 29623, 26657, 26176, 32767, 27961, 0, -27961, -32767, -26176, 
+        -26657, -29623, -27452, -25955, -27778, -27508, -25687, -26307, -26968, -25575, -25198, -26059, 
+        -25397, -24444, -24989, -25007, -23960, -23951, -24356, -23597, -23078, -23501, -23199, -22413, 
+        -22561, -22656, -21909, -21664, -21939, -21461, -20900, -21096, -20959, -20286, -20219, -20333, 
+        -19772, -19405, -19578, -19270, -18708, -18745, -18700, -18123, -17916, -18019, -17596, -17162, 
+        -17241, -17050, -16511, -16424, -16427, -15942, -15637, -15707, -15396, -14930, -14920, -14811, 
+        -14311, -14123, -14145, -13746, -13375, -13399, -13178, -12706, -12612, -12556, -12108, -11839, 
+        -11855, -11539, -11126, -11093, -10946, -10488, -10314, -10289, -9902, -9568, -9562, -9322, 
+        -8888, -8792, -8700, -8273, -8027, -8013, -7690, -7310, -7266, -7093, -6658, -6497, 
+        -6443, -6059, -5751, -5729, -5472, -5063, -4970, -4853, -4435, -4209, -4175, -3844, 
+        -3486, -3439, -3247, -2825, -2676, -2603, -2217, -1928, -1898, -1627, -1232, -1147, 
+        -1012, -596, -386, -342, 0, 
+    },
+    // Octave 4: top 640Hz, 37 harmonics
+    {
+        0, 419, 684, 764, 773, 880, 1179, 1611, 2013, 2244, 2299, 2312, 
+        2449, 2780, 3222, 3604, 3800, 3833, 3853, 4022, 4385, 4833, 5191, 5351, 
+        5364, 5396, 5600, 5993, 6444, 6773, 6897, 6894, 6942, 7183, 7605, 8054, 
+        8352, 8439, 8422, 8491, 8771, 9220, 9663, 9926, 9976, 9948, 10043, 10365, 
+        10840, 11272, 11495, 11506, 11472, 11598, 11965, 12464, 12880, 13058, 13030, 12994, 
+        13157, 13573, 14094, 14487, 14614, 14547, 14513, 14720, 15189, 15731, 16094, 16163, 
+        16053, 16027, 16288, 16817, 17377, 17701, 17701, 17546, 17535, 17863, 18459, 19036, 
+        19308, 19226, 19020, 19034, 19446, 20124, 20714, 20917, 20730, 20466, 20517, 21041, 
+        21823, 22425, 22529, 22201, 21863, 21973, 22658, 23584, 24194, 24146, 23608, 23164, 
+        23375, 24320, 25476, 26092, 25775, 24861, 24230, 24647, 26115, 27749, 28361, 27400, 
+        25542, 24415, 25478, 28745, 32251, 32767, 27507, 15847, 0, -15847, -27507, -32767, 
+        -32251, -28745, -25478, -24415, -25542, -27400, -28361, -27749, -26115, -24647, -24230, -24861, 
+        -25775, -26092, -25476, -24320, -23375, -23164, -23608, -24146, -24194, -23584, -22658, -21973, 
+        -21863, -22201, -22529, -22425, -21823, -21041, -20517, -20466, -20730, -20917, -20714, -20124, 
+        -19446, -19034, -19020, -19226, -19308, -19036, -18459, -17863, -17535, -17546, -17701, -17701, 
+        -17377, -16817, -16288, -16027, -16053, -16163, -16094, -15731, -15189, -14720, -14513, -14547, 
+        -14614, -14487, -14094, -13573, -13157, -12994, -13030, -13058, -12880, -12464, -11965, -11598, 
+        -11472, -11506, -11495, -11272, -10840, -10365, -10043, -9948, -9976, -9926, -9663, -9220, 
+        -8771, -8491, -8422, -8439, -8352, -8054, -7605, -7183, -6942, -6894, -6897, -6773, 
+        -6444, -5993, -5600, -5396, -5364, -5351, -5191, -4833, -4385, -4022, -3853, -3833, 
+        -3800, -3604, -3222, -2780, -2449, -2312, -2299, -2244, -2013, -1611, -1179, -880, 
+        -773, -764, -684, -419, 0, 
+    },
+    // Octave 5: top 1280Hz, 18 harmonics
+    {
+        0, 8, 60, 192, 424, 755, 1163, 1613, 2060, 2458, 2774, 2989, 
+        3106, 3146, 3148, 3156, 3216, 3363, 3611, 3959, 4383, 4842, 5290, 5683, 
+        5986, 6183, 6280, 6302, 6292, 6296, 6360, 6519, 6787, 7157, 7601, 8076, 
+        8532, 8922, 9212, 9389, 9461, 9458, 9427, 9421, 9486, 9657, 9948, 10347, 
+        10821, 11321, 11792, 12184, 12461, 12611, 12649, 12610, 12548, 12521, 12583, 12768, 
+        13089, 13530, 14049, 14588, 15085, 15482, 15744, 15858, 15846, 15751, 15639, 15579, 
+        15631, 15834, 16199, 16703, 17292, 17896, 18437, 18849, 19088, 19147, 19053, 18867, 
+        18670, 18550, 18582, 18813, 19251, 19863, 20576, 21296, 21920, 22361, 22565, 22522, 
+        22276, 21913, 21549, 21308, 21296, 21578, 22167, 23007, 23991, 24970, 25786, 26299, 
+        26419, 26131, 25501, 24673, 23852, 23263, 23116, 23557, 24632, 26264, 28247, 30262, 
+        31910, 32767, 32442, 30635, 27191, 22125, 15640, 8100, 0, -8100, -15640, -22125, 
+        -27191, -30635, -32442, -32767, -31910, -30262, -28247, -26264, -24632, -23557, -23116, -23263, 
+        -23852, -24673, -25501, -26131, -26419, -26299, -25786, -24970, -23991, -23007, -22167, -21578, 
+        -21296, -21308, -21549, -21913, -22276, -22522, -22565, -22361, -21920, -21296, -20576, -19863, 
+        -19251, -18813, -18582, -18550, -18670, -18867, -19053, -19147, -19088, -18849, -18437, -17896, 
+        -17292, -16703, -16199, -15834, -15631, -15579, -15639, -15751, -15846, -15858, -15744, -15482, 
+        -15085, -14588, -14049, -13530, -13089, -12768, -12583, -12521, -12548, -12610, -12649, -12611, 
+        -12461, -12184, -11792, -11321, -10821, -10347, -9948, -9657, -9486, -9421, -9427, -9458, 
+        -9461, -9389, -9212, -8922, -8532, -8076, -7601, -7157, -6787, -6519, -6360, -6296, 
+        -6292, -6302, -6280, -6183, -5986, -5683, -5290, -4842, -4383, -3959, -3611, -3363, 
+        -3216, -3156, -3148, -3146, -3106, -2989, -2774, -2458, -2060, -1613, -1163, -755, 
+        -424, -192, -60, -8, 0, 
+    },
+    // Octave 6: top 2560Hz, 9 harmonics
+    {
+        0, 473, 934, 1369, 1770, 2126, 2431, 2682, 2877, 3020, 3114, 3168, 
+        3191, 3195, 3192, 3196, 3218, 3272, 3366, 3509, 3706, 3961, 4271, 4634, 
+        5044, 5490, 5963, 6450, 6937, 7410, 7858, 8268, 8630, 8938, 9187, 9375, 
+        9505, 9583, 9615, 9612, 9588, 9556, 9531, 9526, 9556, 9633, 9765, 9960, 
+        10220, 10546, 10934, 11376, 11863, 12382, 12918, 13455, 13977, 14467, 14913, 15300, 
+        15621, 15869, 16041, 16139, 16170, 16143, 16071, 15970, 15857, 15751, 15672, 15637, 
+        15663, 15763, 15947, 16221, 16585, 17035, 17563, 18156, 18796, 19464, 20135, 20787, 
+        21397, 21941, 22400, 22758, 23005, 23134, 23146, 23047, 22851, 22576, 22247, 21892, 
+        21542, 21231, 20991, 20853, 20846, 20992, 21308, 21801, 22472, 23310, 24297, 25404, 
+        26592, 27817, 29025, 30160, 31162, 31969, 32523, 32767, 32653, 32139, 31193, 29797, 
+        27943, 25636, 22897, 19758, 16264, 12472, 8448, 4265, 0, -4265, -8448, -12472, 
+        -16264, -19758, -22897, -25636, -27943, -29797, -31193, -32139, -32653, -32767, -32523, -31969, 
+        -31162, -30160, -29025, -27817, -26592, -25404, -24297, -23310, -22472, -21801, -21308, -20992, 
+        -20846, -20853, -20991, -21231, -21542, -21892, -22247, -22576, -22851, -23047, -23146, -23134, 
+        -23005, -22758, -22400, -21941, -21397, -20787, -20135, -19464, -18796, -18156, -17563, -17035, 
+        -16585, -16221, -15947, -15763, -15663, -15637, -15672, -15751, -15857, -15970, -16071, -16143, 
+        -16170, -16139, -16041, -15869, -15621, -15300, -14913, -14467, -13977, -13455, -12918, -12382, 
+        -11863, -11376, -10934, -10546, -10220, -9960, -9765, -9633, -9556, -9526, -9531, -9556, 
+        -9588, -9612, -9615, -9583, -9505, -9375, -9187, -8938, -8630, -8268, -7858, -7410, 
+        -6937, -6450, -5963, -5490, -5044, -4634, -4271, -3961, -3706, -3509, -3366, -3272, 
+        -3218, -3196, -3192, -3195, -3191, -3168, -3114, -3020, -2877, -2682, -2431, -2126, 
+        -1770, -1369, -934, -473, 0, 
+    },
+    // Octave 7: top 5120Hz, 4 harmonics
+    {
+        0, 1, 4, 14, 34, 65, 112, 176, 261, 368, 499, 657, 
+        841, 1054, 1296, 1568, 1869, 2199, 2558, 2944, 3357, 3794, 4253, 4734, 
+        5231, 5745, 6270, 6805, 7346, 7889, 8432, 8971, 9503, 10023, 10530, 11020, 
+        11490, 11937, 12359, 12754, 13119, 13453, 13755, 14024, 14260, 14461, 14629, 14764, 
+        14867, 14939, 14983, 15000, 14993, 14965, 14919, 14859, 14787, 14709, 14627, 14546, 
+        14471, 14405, 14353, 14319, 14306, 14320, 14363, 14439, 14551, 14703, 14895, 15131, 
+        15412, 15739, 16114, 16535, 17002, 17516, 18073, 18672, 19311, 19986, 20694, 21430, 
+        22190, 22968, 23760, 24558, 25358, 26152, 26934, 27696, 28431, 29133, 29793, 30405, 
+        30962, 31457, 31882, 32231, 32499, 32680, 32767, 32757, 32645, 32427, 32101, 31663, 
+        31113, 30449, 29670, 28778, 27773, 26657, 25434, 24106, 22677, 21152, 19537, 17837, 
+        16060, 14213, 12302, 10337, 8326, 6278, 4201, 2105, 0, -2105, -4201, -6278, 
+        -8326, -10337, -12302, -14213, -16060, -17837, -19537, -21152, -22677, -24106, -25434, -26657, 
+        -27773, -28778, -29670, -30449, -31113, -31663, -32101, -32427, -32645, -32757, -32767, -32680, 
+        -32499, -32231, -31882, -31457, -30962, -30405, -29793, -29133, -28431, -27696, -26934, -26152, 
+        -25358, -24558, -23760, -22968, -22190, -21430, -20694, -19986, -19311, -18672, -18073, -17516, 
+        -17002, -16535, -16114, -15739, -15412, -15131, -14895, -14703, -14551, -14439, -14363, -14320, 
+        -14306, -14319, -14353, -14405, -14471, -14546, -14627, -14709, -14787, -14859, -14919, -14965, 
+        -14993, -15000, -14983, -14939, -14867, -14764, -14629, -14461, -14260, -14024, -13755, -13453, 
+        -13119, -12754, -12359, -11937, -11490, -11020, -10530, -10023, -9503, -8971, -8432, -7889, 
+        -7346, -6805, -6270, -5745, -5231, -4734, -4253, -3794, -3357, -2944, -2558, -2199, 
+        -1869, -1568, -1296, -1054, -841, -657, -499, -368, -261, -176, -112, -65, 
+        -34, -14, -4, -1, 0, 
+    },
+    // Octave 8: top 10240Hz, 2 harmonics
+    {
+        0, 0, 1, 5, 12, 23, 40, 63, 95, 134, 184, 244, 
+        315, 399, 497, 608, 735, 877, 1036, 1211, 1404, 1615, 1845, 2094, 
+        2362, 2650, 2957, 3285, 3633, 4000, 4388, 4796, 5224, 5672, 6139, 6625, 
+        7129, 7652, 8192, 8749, 9322, 9910, 10513, 11130, 11760, 12401, 13054, 13716, 
+        14387, 15065, 15750, 16439, 17132, 17828, 18524, 19220, 19914, 20605, 21291, 21971, 
+        22644, 23307, 23959, 24599, 25226, 25837, 26432, 27008, 27565, 28101, 28614, 29103, 
+        29568, 30005, 30415, 30796, 31147, 31466, 31753, 32006, 32224, 32407, 32554, 32663, 
+        32734, 32767, 32760, 32714, 32627, 32500, 32331, 32121, 31870, 31578, 31243, 30867, 
+        30450, 29992, 29493, 28953, 28374, 27755, 27097, 26401, 25667, 24898, 24092, 23252, 
+        22379, 21473, 20535, 19568, 18572, 17549, 16500, 15426, 14330, 13212, 12075, 10920, 
+        9748, 8562, 7363, 6153, 4933, 3706, 2474, 1238, 0, -1238, -2474, -3706, 
+        -4933, -6153, -7363, -8562, -9748, -10920, -12075, -13212, -14330, -15426, -16500, -17549, 
+        -18572, -19568, -20535, -21473, -22379, -23252, -24092, -24898, -25667, -26401, -27097, -27755, 
+        -28374, -28953, -29493, -29992, -30450, -30867, -31243, -31578, -31870, -32121, -32331, -32500, 
+        -32627, -32714, -32760, -32767, -32734, -32663, -32554, -32407, -32224, -32006, -31753, -31466, 
+        -31147, -30796, -30415, -30005, -29568, -29103, -28614, -28101, -27565, -27008, -26432, -25837, 
+        -25226, -24599, -23959, -23307, -22644, -21971, -21291, -20605, -19914, -19220, -18524, -17828, 
+        -17132, -16439, -15750, -15065, -14387, -13716, -13054, -12401, -11760, -11130, -10513, -9910, 
+        -9322, -8749, -8192, -7652, -7129, -6625, -6139, -5672, -5224, -4796, -4388, -4000, 
+        -3633, -3285, -2957, -2650, -2362, -2094, -1845, -1615, -1404, -1211, -1036, -877, 
+        -735, -608, -497, -399, -315, -244, -184, -134, -95, -63, -40, -23, 
+        -12, -5, -1, 0, 0, 
+    },
+    // Octave 9: top 20480Hz, 1 harmonics
+    {
+        0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 
+        9512, 10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 
+        18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811, 
+        25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956, 
+        30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 
+        32609, 32678, 32728, 32757, 32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 
+        32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571, 30273, 29956, 29621, 29268, 
+        28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731, 
+        23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 
+        15446, 14732, 14010, 13279, 12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 
+        6393, 5602, 4808, 4011, 3212, 2410, 1608, 804, 0, -804, -1608, -2410, 
+        -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793, 
+        -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, 
+        -20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, 
+        -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113, 
+        -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757, 
+        -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, 
+        -31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, 
+        -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403, 
+        -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279, 
+        -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, 
+        -3212, -2410, -1608, -804, 0, 
+    },
+};
@@ -2,6 +2,7 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "esp_system.h"
 #include "esp_netif.h"
 #include "esp_event.h"
@@ -12,7 +13,22 @@
 #include "lwip/ip_addr.h"
 #include "lwip/inet.h"
 #include "mynet.h"
-#include "daisysp.h"
+#include "netring.h"
+#include "audiofmt.h"
+#include "jitterbuf.h"
+#include "paramsmooth.h"
+#include "perfmon.h"
+#include "pitchlut.h"
+#include "routing.h"
+#include "patchsave.h"
+#include "ctlstream.h"
+#include "clocksync.h"
+#include "topomgr.h"
+#include "wireproto.h"
+#include "dlog.h"
+#include "wireconfig.h"
+#include "pipeline.h"
+#include "wtosc.h"
 #include <stdint.h>
 #include "esp_log.h"
 #include "lwip/api.h"
@@ -21,26 +37,72 @@
 #define TAG "OSC"
 
 void sender_task(void* pvParameters);
+void tx_task(void* pvParameters);
 void receiver_task(void* pvParameters);
+void ctl_receiver_task(void* pvParameters);
+void clocksync_task(void* pvParameters);
+void topo_task(void* pvParameters);
 
 #define TNetConn struct netconn *
 #define TNetBuf  struct netbuf  *
 
-#ifndef PACK_L24_BE
-#define PACK_L24_BE(p, v) do { \
-    (p)[0] = ((v) >> 16) & 0xFF; \
-    (p)[1] = ((v) >> 8) & 0xFF;  \
-    (p)[2] = (v) & 0xFF;         \
-} while (0)
-#endif
-
-#define SAMPLE_RATE 48000
-#define BLOCK_SIZE 96
-#define UDP_PORT 5005
-#define PACKET_SIZE (BLOCK_SIZE * 3)
+// Wire constants come from wireconfig.h; local names kept for the code below
+#define SAMPLE_RATE WIRE_SAMPLE_RATE
+#define BLOCK_SIZE WIRE_BLOCK_SIZE
+#define UDP_PORT WIRE_AUDIO_PORT
+#define PACKET_SIZE WIRE_PACKET_SIZE
+// Known trip counts for the blend and rx-mix loops
+using BlockPipe = dms::Pipeline<BLOCK_SIZE>;
+static_assert(BlockPipe::kPacketBytes == PACKET_SIZE, "wire format mismatch");
+// Blocks per datagram: 1 keeps audio latency minimal; raise to 2-4 for
+// utility streams to cut packet rate (receivers accept any of them).
+#define TX_BATCH_BLOCKS 1
+#define TX_DATAGRAM_BYTES (sizeof(wireproto_hdr_t) + TX_BATCH_BLOCKS * PACKET_SIZE)
+#define SEND_RING_DEPTH 4  // Preallocated netbufs; > max in-flight pbufs held by EMAC DMA
+#define TX_QUEUE_DEPTH (SEND_RING_DEPTH - 2)  // Render may run at most 2 blocks ahead of tx
+
+// Core topology. lwIP's tcpip_thread lives on PRO (core 0), and every
+// netconn call is a semaphore handoff to it — so the tasks that talk to
+// the stack (tx_task, receiver_task) are pinned beside it, while
+// synthesis renders on APP (core 1) next to the UI and only touches the
+// network through tx_queue. Per-binary: asor uses the same names.
+#define SYNTH_CORE 1
+#define NET_CORE 0
 
 #define PRINT_INTERVAL 5000
 
+// Multicast group this module listens to (another module's stream).
+// Empty string leaves the receiver idle; set to e.g. "239.100.2.151"
+// to patch that stream into this module's output.
+#define RX_MULTICAST_GROUP ""
+#define RX_JITTER_DEPTH 4   // Blocks; steady-state occupancy ~2 (4ms)
+#define RX_PRIME_LEVEL 2    // Don't start pulling until this many buffered
+#define RX_MIX_GAIN 0.5f    // Received stream level in the local mix
+
+// Control-rate input (LFO/envelope modules at ~3kbps instead of 1.15Mbps
+// audio). Empty string leaves the listener idle; received channels show
+// up as routing sources SRC_CTL_BASE..SRC_CTL_BASE+7, so a control
+// stream can drive any destination a knob can.
+#define CTL_RX_GROUP ""
+#define CTL_RX_INTERVAL_BLOCKS 1  // Sender pacing; ramp length at this end
+#define SRC_CTL_BASE NUM_KNOBS
+
+// Sample-clock sync. Empty group disables it; otherwise exactly one
+// module in the rack builds with CLOCKSYNC_MASTER 1 and beacons its
+// clock on this group, and the rest jog their block pacing by ±1 tick
+// to track it (receivers' jitter buffers absorb the 1ms jog).
+#define CLOCKSYNC_GROUP ""  // e.g. "239.100.0.1"
+#define CLOCKSYNC_MASTER 0
+
+// Stream topology. This module announces its output under
+// TOPO_STREAM_NAME on the well-known announce group once a second, and
+// TOPO_RX_STREAM names a stream to patch in by NAME — the group comes
+// from the announce directory and is joined only while referenced, so
+// the switch stops flooding unused streams at this port. Empty
+// TOPO_RX_STREAM keeps the static RX_MULTICAST_GROUP behavior.
+#define TOPO_STREAM_NAME "oscG"
+#define TOPO_RX_STREAM ""  // e.g. "asor"
+
 #define MIN_PW 0.1f  // 10% duty cycle
 #define MAX_PW 0.9f  // 90% duty cycle
 #define MAX_DETUNE_SEMITONES 2.0f  // ±2 semitones (conservative for beats)
@@ -49,34 +111,73 @@ void receiver_task(void* pvParameters);
 #define MAX_DETUNE_SEMITONES 2.0f  // ±2 semitones (conservative for beats)
 #define MAX_FINE_SEMITONES 12.0f   // Full octave for fine tune (enhanced range)
 
-// Global structure definition for task parameters
-struct net_params {
-    uint32_t multicast_ip;
-    ip_addr_t local_addr;
-};
+#define PARAM_RAMP_BLOCKS 8  // Knob changes glide over 8 blocks (16ms)
 
-daisysp::Oscillator osc_saw;  // Sawtooth oscillator
-daisysp::Oscillator osc_pulse;  // Pulse (variable square) oscillator
+dms::WavetableOscillator osc_saw;    // Sawtooth oscillator (mipmapped tables)
+dms::WavetableOscillator osc_pulse;  // Pulse (variable square) oscillator
 
-// Global shared state for raw knob values (updated by UI task)
-volatile float knob_octave = 0.5f;     // KNOB1: Octave
-volatile float knob_balance = 0.5f;    // KNOB3: Balance
-volatile float knob_fine_tune = 0.5f;  // KNOB5: Fine tune
-volatile float knob_pw = 0.5f;         // KNOB7: Pulse width
-volatile float knob_detune = 0.5f;     // KNOB8: Detune
+// Raw knob values arrive through the knobBox seqlock snapshot (see ui.h);
+// sender_task reads one consistent set per block instead of racing the UI
+// task through bare volatiles.
 
 // Derived params (computed in sender_task)
 float g_freq = 440.0f;
 float g_detune_offset = 0.0f;
 float g_fine_offset = 0.0f;
 
+// Patch routing: sources (knob indices today, control streams later) feed
+// named destination slots; sender_task reads destinations only, so what
+// drives a parameter is a table edit, not a code change in the hot loop.
+static routing_table_t g_routes;
+enum { DST_OCTAVE, DST_FINE, DST_DETUNE, DST_BALANCE, DST_PW };  // Registration order
+
 // Global for task
 button_callback_t g_button_cb = NULL;
 
+// Double-buffer pipeline state: render packs into netring slots and queues
+// the filled netbuf; tx_task transmits it while the next block renders.
+static netring_t send_ring;
+static QueueHandle_t tx_queue = NULL;
+static struct netconn *s_send_conn = NULL;
+static ip_addr_t s_multi_addr;
+
+// Receive side: receiver_task drains the socket into this jitter buffer;
+// the render loop pulls and mixes once it has primed.
+static jitterbuf_t rx_jb;
+static volatile bool rx_active = false;
+
+// Control-rate receive state: ctl_receiver_task ingests, sender_task
+// steps the per-channel ramps once per block.
+static ctlstream_rx_t ctl_rx;
+
+// Clock-sync state: clocksync_task ingests beacons, sender_task asks
+// for a tick jog once per block (same sharing pattern as ctl_rx).
+static clocksync_t g_clocksync;
+
+// Topology state: topo_task owns the table (announce, ingest, update);
+// it applies join/leave actions to the receiver's conn, published here.
+// Joins are a handoff to tcpip_thread either way, so the cross-task
+// netconn call is the same path the receiver's own join takes.
+static topo_table_t g_topo;
+static struct netconn *s_rx_conn = NULL;
+
 void exampleButtonCb(uint8_t btn, PressType type) {
     const char* type_str = (type == SHORT_PRESS ? "short" : (type == LONG_PRESS ? "long" : "double"));
     ESP_LOGI(TAG, "Synth: Btn %d %s (e.g., route pot%d to osc freq via patchSave)", btn, type_str, btn);
-    // Future: switch(btn) { case 1: if(type==SHORT_PRESS) set_virtual_route(POT_ADC3, OSC_FREQ); }
+    if (btn == 1 && type == LONG_PRESS) {
+        perfmon_dump();  // Runs in the UI task, off the audio path
+        return;
+    }
+    if (btn == 2 && type == SHORT_PRESS) {
+        // Route editing from a button: toggle which knob drives balance.
+        // The sender picks it up via the table generation, no restart.
+        static bool alt_src = false;
+        alt_src = !alt_src;
+        set_virtual_route(&g_routes, alt_src ? KNOB2 : KNOB3, DST_BALANCE, 1.0f, 0.0f);
+        patchsave_mark_dirty();
+        ESP_LOGI(TAG, "Route: %s -> knob %d", g_routes.dst_names[DST_BALANCE], alt_src ? 2 : 3);
+        return;
+    }
 }
 
 extern "C" void app_main(void) {
@@ -86,35 +187,98 @@ extern "C" void app_main(void) {
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+    patchsave_init();  // Patch persistence; regions restore as they register
+    dlog_init(NET_CORE, 1);  // Deferred-log drain, off the synth core
 
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK(esp_event_loop_create_default());
 
-    ESP_ERROR_CHECK(net_connect());
+    // Kick the PHY settle timers off and keep going: UI, patch restore,
+    // and oscillator init all run during the ~1.7s the PHY needs, and
+    // sender_task below starts rendering before the link is up.
+    ESP_ERROR_CHECK(net_connect_async());
 
     initUI();
     setUILogLevel(ESP_LOG_DEBUG);  // Enable debug for testing
     setButtonCallback(exampleButtonCb);
-    setKnobParam(KNOB1, &knob_octave);     // Register pointers
-    setKnobParam(KNOB3, &knob_balance);
-    setKnobParam(KNOB5, &knob_fine_tune);
-    setKnobParam(KNOB7, &knob_pw);
-    setKnobParam(KNOB8, &knob_detune);
-
-    // Initialize oscillators
+    setKnobParam(KNOB1, NULL);  // Octave — consumed via knobBox snapshot
+    setKnobParam(KNOB3, NULL);  // Balance
+    setKnobParam(KNOB5, NULL);  // Fine tune
+    setKnobParam(KNOB7, NULL);  // Pulse width
+    setKnobParam(KNOB8, NULL);  // Detune
+
+    // Default patch: each destination driven by its traditional knob.
+    // KNOB2 is spare; button 2 re-routes it onto balance (see callback).
+    routing_init(&g_routes);
+    routing_register_dest(&g_routes, "octave", 0.5f);   // Order matches the DST_ enum
+    routing_register_dest(&g_routes, "fine", 0.5f);
+    routing_register_dest(&g_routes, "detune", 0.5f);
+    routing_register_dest(&g_routes, "balance", 0.5f);
+    routing_register_dest(&g_routes, "pw", 0.5f);
+    set_virtual_route(&g_routes, KNOB1, DST_OCTAVE, 1.0f, 0.0f);
+    set_virtual_route(&g_routes, KNOB5, DST_FINE, 1.0f, 0.0f);
+    set_virtual_route(&g_routes, KNOB8, DST_DETUNE, 1.0f, 0.0f);
+    set_virtual_route(&g_routes, KNOB3, DST_BALANCE, 1.0f, 0.0f);
+    set_virtual_route(&g_routes, KNOB7, DST_PW, 1.0f, 0.0f);
+    // Saved routes (through num_routes; names/values are rebuilt above)
+    // overwrite the defaults before any task reads the table.
+    patchsave_region("routes", &g_routes, offsetof(routing_table_t, dst_values));
+
+    // Control-stream ramps must exist before the receiver/sender tasks run
+    ctlstream_rx_init(&ctl_rx, CTL_RX_INTERVAL_BLOCKS);
+    clocksync_init(&g_clocksync);
+    topo_init(&g_topo);
+
+    // Initialize oscillators (band-limited wavetables; top octaves of the
+    // base_freq table no longer alias the way the naive waves did)
     osc_saw.Init(SAMPLE_RATE);
-    osc_saw.SetWaveform(daisysp::Oscillator::WAVE_SAW);
+    osc_saw.SetWaveform(dms::WavetableOscillator::WAVE_SAW);
+    osc_saw.SetAmp(0.5f);  // Match the old daisysp default level
     osc_pulse.Init(SAMPLE_RATE);
-    osc_pulse.SetWaveform(daisysp::Oscillator::WAVE_SQUARE);  // Enables SetPw
+    osc_pulse.SetWaveform(dms::WavetableOscillator::WAVE_SQUARE);  // Enables SetPw
+    osc_pulse.SetAmp(0.5f);
     esp_log_level_set("OSC", ESP_LOG_INFO);  // Changed to INFO for debug visibility
 
+    // Tasks start before the link is up: sender_task warm-renders until
+    // net_is_up() and computes its addresses itself, the receivers block
+    // in net_wait_up. Nothing here waits on the PHY.
+    if (xTaskCreatePinnedToCore(sender_task, "sender_task", 4096, NULL, 2, NULL, SYNTH_CORE) != pdPASS ||
+        xTaskCreatePinnedToCore(receiver_task, "receiver_task", 4096, NULL, 2, NULL, NET_CORE) != pdPASS ||
+        xTaskCreatePinnedToCore(ctl_receiver_task, "ctl_rx_task", 4096, NULL, 2, NULL, NET_CORE) != pdPASS ||
+        xTaskCreatePinnedToCore(clocksync_task, "clocksync", 3072, NULL, 2, NULL, NET_CORE) != pdPASS ||
+        xTaskCreatePinnedToCore(topo_task, "topo", 3072, NULL, 1, NULL, NET_CORE) != pdPASS ||
+        xTaskCreatePinnedToCore(updateUITask, "updateUI", 2048, NULL, 5, NULL, SYNTH_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Task creation failed - check memory");
+    } else {
+        ESP_LOGI(TAG, "Synthesis on core %d, network on core %d", SYNTH_CORE, NET_CORE);
+    }
+}
+
+void sender_task(void* pvParameters) {
+    (void)pvParameters;
+
+    // Warm-render while the PHY settles: oscillator phase and wavetable
+    // cache lines are primed, so the first block after link-up is a real
+    // one — time-to-first-packet is link time alone.
+    {
+        TickType_t warm_wake = xTaskGetTickCount();
+        float warm_a[BLOCK_SIZE], warm_b[BLOCK_SIZE];
+        while (!net_is_up()) {
+            osc_saw.RenderBlock(warm_a, BLOCK_SIZE);
+            osc_pulse.RenderBlock(warm_b, BLOCK_SIZE);
+            vTaskDelayUntil(&warm_wake, 1);
+        }
+    }
+
+    // Addresses derive from the assigned IP, so compute them here rather
+    // than in app_main (which no longer blocks on the link).
     esp_netif_ip_info_t ip_info;
     ESP_ERROR_CHECK(esp_netif_get_ip_info(s_netif, &ip_info));
     uint32_t unicast_ip = ip_info.ip.addr;
     printf("Unicast IP: " IPSTR "\n", IP2STR(&ip_info.ip));
 
     uint8_t* ip_bytes = (uint8_t*)&unicast_ip;
-    uint32_t multicast_ip = (239 << 24) | (100 << 16) | (ip_bytes[2] << 8) | ip_bytes[3];
+    uint32_t multicast_ip = wire_audio_group(ip_bytes[2], ip_bytes[3]);
     ip_addr_t local_addr;
     ip_addr_set_ip4_u32(&local_addr, unicast_ip);
     printf("Computed Multicast: %lu.%lu.%lu.%lu\n",
@@ -123,22 +287,6 @@ extern "C" void app_main(void) {
            (unsigned long)((multicast_ip >> 8) & 0xFF),
            (unsigned long)(multicast_ip & 0xFF));
 
-    BaseType_t core_id = 0;
-
-    struct net_params params = {multicast_ip, local_addr};
-    if (xTaskCreatePinnedToCore(sender_task, "sender_task", 4096, (void*)&params, 2, NULL, core_id) != pdPASS ||
-        xTaskCreatePinnedToCore(receiver_task, "receiver_task", 4096, (void*)&params, 2, NULL, core_id) != pdPASS ||
-        xTaskCreatePinnedToCore(updateUITask, "updateUI", 2048, NULL, 5, NULL, 1) != pdPASS) {  // Pin to core 1
-        ESP_LOGE(TAG, "Task creation failed - check memory");
-    } else {
-        ESP_LOGI(TAG, "Tasks created and pinned to core %d", core_id);
-    }
-}
-
-void sender_task(void* pvParameters) {
-    struct net_params *params = (struct net_params *)pvParameters;
-    uint32_t multicast_ip = params->multicast_ip;
-    ip_addr_t local_addr = params->local_addr;
     struct netconn *conn = netconn_new(NETCONN_UDP);
     if (conn == NULL) {
         printf("Sender: Failed to create netconn: %s (errno %d)\n", strerror(errno), errno);
@@ -153,11 +301,10 @@ void sender_task(void* pvParameters) {
     // Attempt to join multicast group with IP_ADDR_ANY as interface
     ip_addr_t any_addr;
     ip_addr_copy(any_addr, *IP_ADDR_ANY); // Initialize any_addr as IP_ADDR_ANY
-    ip_addr_t multi_addr;
-    ip_addr_set_ip4_u32(&multi_addr, htonl(multicast_ip)); // Ensure network byte order
+    ip_addr_set_ip4_u32(&s_multi_addr, htonl(multicast_ip)); // Ensure network byte order
     printf("Sender: Joining multicast group (raw: 0x%08x, converted: %s, addr: 0x%08x)\n",
-           (unsigned int)multicast_ip, ip4addr_ntoa((ip4_addr_t*)&multi_addr), (unsigned int)multi_addr.u_addr.ip4.addr);
-    err = netconn_join_leave_group(conn, &multi_addr, &any_addr, NETCONN_JOIN);
+           (unsigned int)multicast_ip, ip4addr_ntoa((ip4_addr_t*)&s_multi_addr), (unsigned int)s_multi_addr.u_addr.ip4.addr);
+    err = netconn_join_leave_group(conn, &s_multi_addr, &any_addr, NETCONN_JOIN);
     if (err != ERR_OK) {
         printf("Sender: Failed to join multicast group, err: %d\n", err);
     } else {
@@ -171,84 +318,472 @@ void sender_task(void* pvParameters) {
            (unsigned long)(multicast_ip & 0xFF), UDP_PORT,
            ip4addr_ntoa((ip4_addr_t*)&local_addr));
 
+    // Preallocate the send buffers once; the 2ms loop below never allocates
+    if (netring_init(&send_ring, SEND_RING_DEPTH, TX_DATAGRAM_BYTES) != ESP_OK) {
+        printf("Sender: netring_init failed, no memory for send ring\n");
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+
+    // Spawn the transmit half of the pipeline: block N goes out on the wire
+    // while block N+1 renders, so a slow send no longer eats render budget.
+    s_send_conn = conn;
+    tx_queue = xQueueCreate(TX_QUEUE_DEPTH, sizeof(struct netbuf *));
+    if (tx_queue == NULL ||
+        xTaskCreatePinnedToCore(tx_task, "tx_task", 4096, NULL, 3, NULL, NET_CORE) != pdPASS) {
+        printf("Sender: tx pipeline setup failed\n");
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+
     TickType_t last_wake_time = xTaskGetTickCount();
-    int packet_count = 0;
-    int64_t start_time = esp_timer_get_time();  // For throughput
-    int64_t total_bytes = 0;
+    int overrun_count = 0;
+
+    // Batch state: blocks accumulate into one datagram until full
+    struct netbuf *batch_buf = NULL;
+    uint8_t *batch_payload = NULL;
+    int batch_fill = 0;
+    bool batch_drop = false;
+    uint32_t tx_seq = 0;
+    uint32_t batch_clock = 0;  // Sample clock of the first block in the batch
 
     // Octave base frequencies (C3 to C8)
     float base_freq[] = {130.81f, 261.63f, 523.25f, 1046.50f, 2093.00f, 4186.01f, 8372.02f, 16744.04f};
 
+    // Routing sources: knob snapshot first, control-stream channels after
+    float sources[NUM_KNOBS + CTLSTREAM_MAX_CHANNELS] = {0};
+    uint32_t last_gen = parambox_read(&knobBox, sources, NUM_KNOBS) - 1;  // Force initial recompute
+    int last_q_oct = -1, last_q_fine = -1, last_q_det = -1;  // Quantized pitch-knob steps
+    uint32_t last_route_gen = g_routes.gen - 1;  // Route edits retrigger the recompute
+
+    // Knob changes become per-block ramps: pitches step in equal ratios,
+    // balance and pw linearly, so the audio loop never sees a jump.
+    dms::SmoothedRatio smooth_saw_freq, smooth_pulse_freq;
+    dms::SmoothedParam smooth_balance, smooth_pw;
+    smooth_saw_freq.Init(440.0f, PARAM_RAMP_BLOCKS);
+    smooth_pulse_freq.Init(440.0f, PARAM_RAMP_BLOCKS);
+    smooth_balance.Init(0.5f, PARAM_RAMP_BLOCKS);
+    smooth_pw.Init(0.5f, PARAM_RAMP_BLOCKS);
+
     while (1) {
-        if (knobsUpdated) {
-            // Compute derived params
-            int octave_step = (int)(knob_octave * 8.0f);
-            octave_step = (octave_step > 7) ? 7 : ((octave_step < 0) ? 0 : octave_step);
-            float octave_base = base_freq[octave_step];
-            float fine_adj = powf(2.0f, (knob_fine_tune - 0.5f) * MAX_FINE_SEMITONES / 12.0f);  // Enhanced: ±12 semitones as ratio
-            g_freq = octave_base * fine_adj;
-            g_detune_offset = (knob_detune - 0.5f) * MAX_DETUNE_SEMITONES / 12.0f;  // ±2 semitones as ratio
-            osc_saw.SetFreq(g_freq * powf(2.0f, g_detune_offset));
-            osc_pulse.SetFreq(g_freq);  // Apply base to pulse
-            osc_pulse.SetPw(MIN_PW + knob_pw * (MAX_PW - MIN_PW));
-            knobsUpdated = 0;
-            ESP_LOGI(TAG, "Sender: Knobs updated, recomputed (freq=%.2f, balance=%.2f, pw=%.2f, detune=%.2f, oct=%.2f, fine=%.2f)",
-                     g_freq, knob_balance, knob_pw, g_detune_offset, knob_octave, knob_fine_tune);
-        }
-
-        struct netbuf *buf = netbuf_new();
-        if (buf == NULL) {
-            printf("Sender: netbuf_new failed\n");
-            vTaskDelay(1);
-            continue;
+        // One consistent knob snapshot per block; recompute only when the
+        // UI task actually published a new generation.
+        uint32_t gen = parambox_read(&knobBox, sources, NUM_KNOBS);
+        // Advance the control-stream ramps one block; while a remote LFO
+        // is moving, the routes re-evaluate every block.
+        int ctl_moving = ctlstream_rx_step(&ctl_rx, sources + SRC_CTL_BASE);
+        uint32_t route_gen = g_routes.gen;
+        if (gen != last_gen || route_gen != last_route_gen || ctl_moving > 0) {
+            last_gen = gen;
+            last_route_gen = route_gen;
+            // One table walk maps sources onto destination slots; below
+            // here only destination names appear, never knob indices.
+            routing_apply(&g_routes, sources);
+            // Quantize the pitch destinations; residual ADC jitter inside
+            // one of the 512 steps no longer reaches the recompute (or the
+            // powf hiding in SmoothedRatio::SetTarget).
+            int q_oct = pitchlut_quantize(routing_value(&g_routes, DST_OCTAVE));
+            int q_fine = pitchlut_quantize(routing_value(&g_routes, DST_FINE));
+            int q_det = pitchlut_quantize(routing_value(&g_routes, DST_DETUNE));
+            if (q_oct != last_q_oct || q_fine != last_q_fine || q_det != last_q_det) {
+                last_q_oct = q_oct; last_q_fine = q_fine; last_q_det = q_det;
+                int octave_step = q_oct * 8 / PITCHLUT_STEPS;
+                octave_step = (octave_step > 7) ? 7 : octave_step;
+                float octave_base = base_freq[octave_step];
+                float fine_st = (pitchlut_step_value(q_fine) - 0.5f) * MAX_FINE_SEMITONES;
+                g_freq = octave_base * pitchlut_ratio(fine_st);  // Table read, no powf
+                float detune_st = (pitchlut_step_value(q_det) - 0.5f) * MAX_DETUNE_SEMITONES;
+                g_detune_offset = detune_st / 12.0f;
+                smooth_saw_freq.SetTarget(g_freq * pitchlut_ratio(detune_st));
+                smooth_pulse_freq.SetTarget(g_freq);  // Apply base to pulse
+                dlog_write("Sender: recomputed freq=%.2f balance=%.2f pw=%.2f detune=%.2f",
+                           g_freq, routing_value(&g_routes, DST_BALANCE),
+                           routing_value(&g_routes, DST_PW), g_detune_offset);
+            }
+            // Linear targets are a couple of flops; no caching needed
+            smooth_pw.SetTarget(MIN_PW + routing_value(&g_routes, DST_PW) * (MAX_PW - MIN_PW));
+            smooth_balance.SetTarget(routing_value(&g_routes, DST_BALANCE));
+        }
+        // Advance the ramps one block: a multiply/add each, no powf here
+        osc_saw.SetFreq(smooth_saw_freq.NextBlock());
+        osc_pulse.SetFreq(smooth_pulse_freq.NextBlock());
+        osc_pulse.SetPw(smooth_pw.NextBlock());
+        float knob_balance = smooth_balance.NextBlock();
+
+        if (batch_fill == 0) {
+            // Claim a ring slot only when the tx queue has room: with the
+            // queue full a stalled send could still hold the oldest slot,
+            // and claiming anyway would wrap the ring onto it and rewrite
+            // the payload mid-flight. The render below still runs (phase
+            // and ramps advance); the batch is dropped before packing.
+            batch_drop = uxQueueMessagesWaiting(tx_queue) >= TX_QUEUE_DEPTH;
+            if (!batch_drop) {
+                batch_buf = netring_next(&send_ring, &batch_payload);
+                // Stamp the batch with the sample clock of its first block so
+                // receivers can reorder and measure loss (wraps every ~24.8h).
+                batch_clock = (uint32_t)((esp_timer_get_time() * (int64_t)SAMPLE_RATE) / 1000000);
+            }
         }
 
-        uint8_t *data = (uint8_t *)netbuf_alloc(buf, PACKET_SIZE);
-        if (data == NULL) {
-            printf("Sender: netbuf_alloc failed\n");
-            netbuf_delete(buf);
-            vTaskDelay(1);
-            continue;
+        float block[BLOCK_SIZE];
+        float saw_block[BLOCK_SIZE], pulse_block[BLOCK_SIZE];
+        perfmon_begin(PERF_STAGE_RENDER);
+        // Whole block per voice: oscillator state stays in registers for
+        // 96 samples instead of being reloaded per Process() call.
+        osc_saw.RenderBlock(saw_block, BLOCK_SIZE);
+        osc_pulse.RenderBlock(pulse_block, BLOCK_SIZE);
+        const float w_saw = 1.0f - knob_balance;
+        const float w_pulse = knob_balance;
+        BlockPipe::Blend(block, saw_block, pulse_block, w_saw, w_pulse);
+        perfmon_end(PERF_STAGE_RENDER);
+        // Mix in the received stream, if one is patched and primed
+        if (rx_active) {
+            uint8_t rx_bytes[JITTERBUF_BLOCK_BYTES] __attribute__((aligned(4)));
+            float rx_block[BLOCK_SIZE];
+            jitterbuf_pull(&rx_jb, rx_bytes);  // Conceals on underrun
+            audiofmt_unpack_l24be(rx_bytes, BLOCK_SIZE, rx_block);
+            BlockPipe::MixIn(block, rx_block, RX_MIX_GAIN);
+        }
+
+        if (!batch_drop) {
+            uint8_t *data = batch_payload + sizeof(wireproto_hdr_t) + batch_fill * PACKET_SIZE;
+            perfmon_begin(PERF_STAGE_PACK);
+            audiofmt_pack_l24be(block, BLOCK_SIZE, data);  // One pass, straight into the netbuf
+            perfmon_end(PERF_STAGE_PACK);
         }
 
-        int64_t loop_start = esp_timer_get_time();  // Latency start
-        int offset = 0;
-        for (int i = 0; i < BLOCK_SIZE; ++i) {
-            float saw_sample = osc_saw.Process();
-            float pulse_sample = osc_pulse.Process();
-            // Mix based on balance
-            float sample = (1.0f - knob_balance) * saw_sample + knob_balance * pulse_sample;
-            int32_t value = static_cast<int32_t>(sample * 8388607.0f);
-            PACK_L24_BE(&data[offset], value);  // Direct packing into netbuf
-            offset += 3;
+        if (++batch_fill >= TX_BATCH_BLOCKS) {
+            batch_fill = 0;
+            if (batch_drop) {
+                // The network is more than TX_QUEUE_DEPTH datagrams behind;
+                // the seq still advances so receivers count the gap as loss.
+                tx_seq++;
+                if (++overrun_count % 500 == 1) {
+                    dlog_write("Sender: tx queue full, dropped block (%.0f overruns)",
+                               (float)overrun_count, 0, 0, 0);
+                }
+            } else {
+                wireproto_write_hdr((wireproto_hdr_t *)batch_payload, TX_BATCH_BLOCKS, tx_seq++, batch_clock);
+                // Hand off to tx_task; this task is the only producer, so
+                // the occupancy check above guarantees room here.
+                xQueueSend(tx_queue, &batch_buf, 0);
+            }
         }
 
-        err_t err = netconn_sendto(conn, buf, &multi_addr, UDP_PORT);  // Send to multicast addr
-        int64_t send_end = esp_timer_get_time();  // Latency end
+        // Clock discipline: jog the tick target by ±1 when this module
+        // has drifted a tick's worth of samples from the master (no-op
+        // until beacons arrive).
+        last_wake_time += clocksync_tick_adjust(&g_clocksync, SAMPLE_RATE / 1000);
+        vTaskDelayUntil(&last_wake_time, 1);  // 1ms delay
+    }
+
+    netconn_delete(conn);
+    vTaskDelete(NULL);
+}
+
+void tx_task(void* pvParameters) {
+    int packet_count = 0;
+    int64_t start_time = esp_timer_get_time();  // For throughput
+    int64_t total_bytes = 0;
+    struct netbuf *buf;
+
+    while (1) {
+        if (xQueueReceive(tx_queue, &buf, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        int64_t send_start = esp_timer_get_time();
+        perfmon_begin(PERF_STAGE_SEND);
+        err_t err = netconn_sendto(s_send_conn, buf, &s_multi_addr, UDP_PORT);
+        perfmon_end(PERF_STAGE_SEND);
+        int64_t send_end = esp_timer_get_time();
 
         if (err == ERR_OK) {
             packet_count++;
-            total_bytes += PACKET_SIZE;
+            total_bytes += TX_DATAGRAM_BYTES;
             if (packet_count % PRINT_INTERVAL == 0) {
                 int64_t elapsed_us = send_end - start_time;
                 float throughput_kbps = (total_bytes * 8.0f / 1024.0f) / (elapsed_us / 1000000.0f);
-                printf("Sender: Sent %d bytes (packet #%d), Throughput=%.2f kbps, Latency=%.2f us\n",
-                       PACKET_SIZE, packet_count, throughput_kbps, (float)(send_end - loop_start));
+                printf("Sender: Sent %d bytes (packet #%d), Throughput=%.2f kbps, Send=%.2f us\n",
+                       (int)TX_DATAGRAM_BYTES, packet_count, throughput_kbps, (float)(send_end - send_start));
                 start_time = esp_timer_get_time();  // Reset
                 total_bytes = 0;
             }
         } else {
             printf("Sender: Sendto failed: %d\n", err);
         }
+    }
+}
 
-        netbuf_delete(buf);  // Free the netbuf
-        vTaskDelayUntil(&last_wake_time, 1);  // 1ms delay
+void receiver_task(void* pvParameters) {
+    if (RX_MULTICAST_GROUP[0] == '\0' && TOPO_RX_STREAM[0] == '\0') {
+        // No stream patched into this module; nothing to do
+        while (1) vTaskDelay(pdMS_TO_TICKS(1000));
     }
+    net_wait_up(UINT32_MAX);  // Group join needs the interface up
 
-    netconn_delete(conn);
-    vTaskDelete(NULL);
+    jitterbuf_init(&rx_jb, RX_JITTER_DEPTH);
+
+    struct netconn *conn = netconn_new(NETCONN_UDP);
+    if (conn == NULL) {
+        printf("Receiver: Failed to create netconn\n");
+        vTaskDelete(NULL);
+    }
+    err_t err = netconn_bind(conn, IP_ADDR_ANY, UDP_PORT);
+    if (err != ERR_OK) {
+        printf("Receiver: Bind failed: %d\n", err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+
+    if (RX_MULTICAST_GROUP[0] != '\0') {
+        // Static patch: join at startup, the pre-topology behavior
+        ip_addr_t group_addr;
+        ipaddr_aton(RX_MULTICAST_GROUP, &group_addr);
+        ip_addr_t any_addr;
+        ip_addr_copy(any_addr, *IP_ADDR_ANY);
+        err = netconn_join_leave_group(conn, &group_addr, &any_addr, NETCONN_JOIN);
+        if (err != ERR_OK) {
+            printf("Receiver: Failed to join %s, err: %d\n", RX_MULTICAST_GROUP, err);
+            netconn_delete(conn);
+            vTaskDelete(NULL);
+        }
+        printf("Receiver: Listening on %s:%d\n", RX_MULTICAST_GROUP, UDP_PORT);
+    } else {
+        printf("Receiver: Waiting for topology join of \"%s\"\n", TOPO_RX_STREAM);
+    }
+    s_rx_conn = conn;  // topo_task applies named-stream joins/leaves here
+
+    int bad_size = 0;
+    while (1) {
+        struct netbuf *nb;
+        err = netconn_recv(conn, &nb);  // Blocks in lwIP, no polling
+        if (err != ERR_OK) {
+            continue;
+        }
+        uint8_t *payload;
+        u16_t len;
+        netbuf_data(nb, (void**)&payload, &len);
+        int nblocks = 0;
+        const uint8_t *blocks = payload;
+        if (len == PACKET_SIZE) {
+            nblocks = 1;  // Legacy bare-block datagram
+        } else if (len >= WIREPROTO_HDR_V1_BYTES) {
+            int hdr_bytes = 0;
+            nblocks = wireproto_parse_hdr((wireproto_hdr_t *)payload, len, &hdr_bytes);
+            blocks = payload + hdr_bytes;
+        }
+        if (nblocks > 0) {
+            for (int k = 0; k < nblocks; k++) {
+                jitterbuf_push(&rx_jb, blocks + k * PACKET_SIZE);
+            }
+            if (!rx_active && jitterbuf_level(&rx_jb) >= RX_PRIME_LEVEL) {
+                rx_active = true;  // Primed: render loop starts pulling
+                printf("Receiver: Stream primed, mixing at %.2f\n", RX_MIX_GAIN);
+            }
+        } else if (++bad_size % 500 == 1) {
+            printf("Receiver: Unexpected packet size %d (%d so far)\n", len, bad_size);
+        }
+        netbuf_delete(nb);
+    }
 }
 
-void receiver_task(void* pvParameters) {
-    while (1) vTaskDelay(pdMS_TO_TICKS(20));
+void ctl_receiver_task(void* pvParameters) {
+    if (CTL_RX_GROUP[0] == '\0') {
+        // No control stream patched into this module; nothing to do
+        while (1) vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+    net_wait_up(UINT32_MAX);  // Group join needs the interface up
+
+    struct netconn *conn = netconn_new(NETCONN_UDP);
+    if (conn == NULL) {
+        printf("CtlRx: Failed to create netconn\n");
+        vTaskDelete(NULL);
+    }
+    err_t err = netconn_bind(conn, IP_ADDR_ANY, CTLSTREAM_PORT);
+    if (err != ERR_OK) {
+        printf("CtlRx: Bind failed: %d\n", err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+
+    ip_addr_t group_addr;
+    ipaddr_aton(CTL_RX_GROUP, &group_addr);
+    ip_addr_t any_addr;
+    ip_addr_copy(any_addr, *IP_ADDR_ANY);
+    err = netconn_join_leave_group(conn, &group_addr, &any_addr, NETCONN_JOIN);
+    if (err != ERR_OK) {
+        printf("CtlRx: Failed to join %s, err: %d\n", CTL_RX_GROUP, err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+    printf("CtlRx: Listening on %s:%d\n", CTL_RX_GROUP, CTLSTREAM_PORT);
+
+    int bad_size = 0;
+    while (1) {
+        struct netbuf *nb;
+        err = netconn_recv(conn, &nb);
+        if (err != ERR_OK) {
+            continue;
+        }
+        uint8_t *payload;
+        u16_t len;
+        netbuf_data(nb, (void**)&payload, &len);
+        if (ctlstream_rx_ingest(&ctl_rx, payload, len) == 0 && ++bad_size % 500 == 1) {
+            printf("CtlRx: Unexpected packet size %d (%d so far)\n", len, bad_size);
+        }
+        netbuf_delete(nb);
+    }
+}
+
+// Clock-sync beacons: master multicasts its sample clock a few times a
+// second; slaves ingest and let sender_task jog its pacing. Idle when
+// no group is configured.
+void clocksync_task(void* pvParameters) {
+    if (CLOCKSYNC_GROUP[0] == '\0') {
+        while (1) vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+    net_wait_up(UINT32_MAX);
+
+    struct netconn *conn = netconn_new(NETCONN_UDP);
+    if (conn == NULL) {
+        printf("ClockSync: Failed to create netconn\n");
+        vTaskDelete(NULL);
+    }
+    ip_addr_t group_addr;
+    ipaddr_aton(CLOCKSYNC_GROUP, &group_addr);
+
+#if CLOCKSYNC_MASTER
+    uint32_t seq = 0;
+    printf("ClockSync: Master beaconing to %s:%d\n", CLOCKSYNC_GROUP, CLOCKSYNC_PORT);
+    while (1) {
+        struct netbuf *nb = netbuf_new();
+        clocksync_beacon_t *b = (clocksync_beacon_t *)netbuf_alloc(nb, sizeof(*b));
+        if (b) {
+            // Same clock the audio headers carry, so slaves track the
+            // stream they actually hear
+            uint32_t sample_clock = (uint32_t)((esp_timer_get_time() * (int64_t)SAMPLE_RATE) / 1000000);
+            clocksync_write_beacon(b, seq++, sample_clock);
+            netconn_sendto(conn, nb, &group_addr, CLOCKSYNC_PORT);
+        }
+        netbuf_delete(nb);
+        vTaskDelay(pdMS_TO_TICKS(CLOCKSYNC_INTERVAL_MS));
+    }
+#else
+    err_t err = netconn_bind(conn, IP_ADDR_ANY, CLOCKSYNC_PORT);
+    if (err != ERR_OK) {
+        printf("ClockSync: Bind failed: %d\n", err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+    ip_addr_t any_addr;
+    ip_addr_copy(any_addr, *IP_ADDR_ANY);
+    err = netconn_join_leave_group(conn, &group_addr, &any_addr, NETCONN_JOIN);
+    if (err != ERR_OK) {
+        printf("ClockSync: Failed to join %s, err: %d\n", CLOCKSYNC_GROUP, err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+    printf("ClockSync: Slave listening on %s:%d\n", CLOCKSYNC_GROUP, CLOCKSYNC_PORT);
+    while (1) {
+        struct netbuf *nb;
+        err = netconn_recv(conn, &nb);
+        if (err != ERR_OK) {
+            continue;
+        }
+        uint8_t *payload;
+        u16_t len;
+        netbuf_data(nb, (void**)&payload, &len);
+        clocksync_ingest(&g_clocksync, payload, len, esp_timer_get_time());
+        netbuf_delete(nb);
+    }
+#endif
+}
+
+// Stream topology: announce this module's output once a second, ingest
+// everyone else's announces, and apply the lazy join/leave diff to the
+// receiver's conn. The announce group itself is the only join a module
+// holds unconditionally; audio groups come and go with the patch.
+void topo_task(void* pvParameters) {
+    net_wait_up(UINT32_MAX);
+
+    struct netconn *conn = netconn_new(NETCONN_UDP);
+    if (conn == NULL) {
+        printf("Topo: Failed to create netconn\n");
+        vTaskDelete(NULL);
+    }
+    err_t err = netconn_bind(conn, IP_ADDR_ANY, TOPO_PORT);
+    if (err != ERR_OK) {
+        printf("Topo: Bind failed: %d\n", err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+    ip_addr_t announce_addr;
+    ipaddr_aton(TOPO_ANNOUNCE_GROUP, &announce_addr);
+    ip_addr_t any_addr;
+    ip_addr_copy(any_addr, *IP_ADDR_ANY);
+    err = netconn_join_leave_group(conn, &announce_addr, &any_addr, NETCONN_JOIN);
+    if (err != ERR_OK) {
+        printf("Topo: Failed to join %s, err: %d\n", TOPO_ANNOUNCE_GROUP, err);
+        netconn_delete(conn);
+        vTaskDelete(NULL);
+    }
+    // Recv doubles as the announce pacer: it returns on each incoming
+    // announce or after the interval, whichever first
+    netconn_set_recvtimeout(conn, TOPO_ANNOUNCE_INTERVAL_MS);
+
+    if (TOPO_RX_STREAM[0] != '\0') {
+        topo_want(&g_topo, TOPO_RX_STREAM);  // Patch references it from boot
+    }
+    printf("Topo: Announcing \"%s\" on %s:%d\n", TOPO_STREAM_NAME,
+           TOPO_ANNOUNCE_GROUP, TOPO_PORT);
+
+    int64_t last_announce = 0;
+    while (1) {
+        int64_t now = esp_timer_get_time();
+
+        // Our stream group derives from the IP the sender computed; skip
+        // announcing for the few ms before it has (s_multi_addr still 0)
+        uint32_t own_group = ip_addr_get_ip4_u32(&s_multi_addr);
+        if (own_group != 0 && now - last_announce >= (int64_t)TOPO_ANNOUNCE_INTERVAL_MS * 1000) {
+            last_announce = now;
+            struct netbuf *nb = netbuf_new();
+            topo_announce_t *a = (topo_announce_t *)netbuf_alloc(nb, sizeof(*a));
+            if (a) {
+                topo_write_announce(a, TOPO_STREAM_NAME, TOPO_TYPE_AUDIO,
+                                    own_group, UDP_PORT,
+                                    SAMPLE_RATE / BLOCK_SIZE / TX_BATCH_BLOCKS);
+                netconn_sendto(conn, nb, &announce_addr, TOPO_PORT);
+            }
+            netbuf_delete(nb);
+        }
+
+        struct netbuf *nb;
+        err = netconn_recv(conn, &nb);
+        if (err == ERR_OK) {
+            uint8_t *payload;
+            u16_t len;
+            netbuf_data(nb, (void**)&payload, &len);
+            topo_ingest(&g_topo, payload, len, esp_timer_get_time());
+            netbuf_delete(nb);
+        }
+
+        // Diff wants against the directory and apply the membership
+        // changes. The table records a join/leave only on the ack after
+        // the stack call succeeds, so anything skipped here (receiver
+        // not bound yet) or refused by lwIP is re-emitted next update.
+        topo_action_t acts[4];
+        int n = topo_update(&g_topo, esp_timer_get_time(), acts, 4);
+        for (int i = 0; i < n; i++) {
+            if (s_rx_conn == NULL) break;
+            ip_addr_t group_addr;
+            ip_addr_set_ip4_u32(&group_addr, acts[i].group);
+            err = netconn_join_leave_group(s_rx_conn, &group_addr, &any_addr,
+                                           acts[i].join ? NETCONN_JOIN : NETCONN_LEAVE);
+            if (err == ERR_OK) topo_ack_action(&g_topo, &acts[i]);
+            printf("Topo: %s \"%s\" (%s) %s\n",
+                   acts[i].join ? "Join" : "Leave", acts[i].name,
+                   ip4addr_ntoa((ip4_addr_t*)&group_addr),
+                   err == ERR_OK ? "ok" : "failed, will retry");
+        }
+    }
 }
@@ -1,46 +1,87 @@
 #pragma once
 #include <stdint.h>
-#include "stmlib/stmlib.h"  // Assuming from your Plaits reuse; else use stdint
+#include <stddef.h>
+#include <math.h>
 
 namespace dms {  // Digital Modular Synth namespace
 
+// Sine lookup: 2^kSineTableBits entries + 1 guard for interpolation.
+// Built once on first Init(); ~2KB of int16, shared by all instances.
+static const int kSineTableBits = 10;
+static const int kSineTableSize = 1 << kSineTableBits;
+
 class Oscillator {
 public:
-    Oscillator() : phase_(0.0f), frequency_(440.0f), shape_(0.0f) {}
+    Oscillator() : phase_(0), phase_inc_(0), frequency_(440.0f), shape_(0.0f), sample_rate_(48000) {}
     ~Oscillator() {}
 
     void Init(int sample_rate) {
         sample_rate_ = sample_rate;
-        phase_inc_ = 0.0f;
+        phase_ = 0;
+        BuildSineTable();
+        UpdatePhaseInc();
     }
 
     inline void SetFrequency(float freq) { frequency_ = freq; UpdatePhaseInc(); }
-    inline void SetShape(float shape) { shape_ = stmlib::CONSTRAIN(shape, 0.0f, 1.0f); }
+    inline void SetShape(float shape) {
+        shape_ = (shape < 0.0f) ? 0.0f : ((shape > 1.0f) ? 1.0f : shape);
+    }
 
+    // Block renderer: 32-bit phase accumulator, interpolated table sine,
+    // no transcendentals or branches on shape in the per-sample loop.
+    // Renders size samples (one 96-sample block per call in the senders)
+    // into a caller-provided buffer, full-scale int16.
     void Render(int16_t* buffer, size_t size) {
-        for (size_t i = 0; i < size; ++i) {
-            // Basic sine + square morph (0=sine, 1=square)
-            float phase = phase_;
-            float sine = sinf(2.0f * M_PI * phase);
-            float square = (phase < 0.5f) ? 1.0f : -1.0f;
-            float sample = (1.0f - shape_) * sine + shape_ * square;
+        uint32_t phase = phase_;
+        const uint32_t inc = phase_inc_;
+        // Shape blend hoisted out of the loop: Q15 weights, computed per block
+        const int32_t w_sine = (int32_t)((1.0f - shape_) * 32767.0f);
+        const int32_t w_square = (int32_t)(shape_ * 32767.0f);
 
-            // Quantize to 24-bit signed (-1 to 1 -> -8388608 to 8388607)
-            buffer[i] = (int16_t)(sample * 8388607.0f);  // Scale; extend to 24-bit if needed
+        for (size_t i = 0; i < size; ++i) {
+            // Table index from top bits, linear interp from the next 16
+            uint32_t idx = phase >> (32 - kSineTableBits);
+            int32_t frac = (phase >> (16 - kSineTableBits)) & 0xFFFF;
+            int32_t s0 = sine_table_[idx];
+            int32_t s1 = sine_table_[idx + 1];
+            int32_t sine = s0 + (((s1 - s0) * frac) >> 16);
+            // Square from the phase MSB: +32767 first half, -32767 second
+            int32_t square = ((int32_t)phase >= 0) ? 32767 : -32767;
 
-            phase_ += phase_inc_;
-            if (phase_ >= 1.0f) phase_ -= 1.0f;
+            buffer[i] = (int16_t)((sine * w_sine + square * w_square) >> 15);
+            phase += inc;  // Wraps for free at 2^32
         }
+        phase_ = phase;
+    }
+
+    // Scalar fallback kept for callers that interleave per-sample work.
+    inline int16_t Process() {
+        int16_t out;
+        Render(&out, 1);
+        return out;
     }
 
 private:
     void UpdatePhaseInc() {
-        phase_inc_ = frequency_ / sample_rate_;
-        stmlib::CONSTRAIN(phase_inc_, 0.0f, 1.0f);
+        float ratio = frequency_ / (float)sample_rate_;
+        if (ratio < 0.0f) ratio = 0.0f;
+        if (ratio > 0.5f) ratio = 0.5f;  // Clamp at Nyquist
+        phase_inc_ = (uint32_t)(ratio * 4294967296.0f);
     }
 
-    float phase_;
-    float phase_inc_;
+    static void BuildSineTable() {
+        if (sine_table_built_) return;
+        for (int i = 0; i <= kSineTableSize; ++i) {
+            sine_table_[i] = (int16_t)(sinf(2.0f * (float)M_PI * i / kSineTableSize) * 32767.0f);
+        }
+        sine_table_built_ = true;
+    }
+
+    inline static int16_t sine_table_[kSineTableSize + 1];
+    inline static bool sine_table_built_ = false;
+
+    uint32_t phase_;      // Q0.32 phase accumulator
+    uint32_t phase_inc_;  // Q0.32 per-sample increment
     float frequency_;
     float shape_;
     int sample_rate_;
@@ -0,0 +1,234 @@
+// Native multi-stream receiver for the monitoring rig.
+//
+// audioRecv.py tops out at a handful of streams (per-sample
+// struct.unpack under the GIL); this one joins N multicast groups, one
+// socket per group so per-stream counters come for free, batch-converts
+// the 24-bit blocks, and writes the mixed stream as signed 32-bit LE
+// mono on stdout — pipe it to aplay or a file. Loss/late/jitter
+// counters go to stderr every STATS_INTERVAL seconds, same cadence as
+// the Python version.
+//
+// The first group listed is the mix clock: each of its blocks triggers
+// one output block mixing the most recent block from every stream, so
+// output pacing follows the first sender and slow/lossy streams repeat
+// their last block instead of stalling the mix.
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "wireproto.h"
+#include "wireconfig.h"
+#include "audiofmt.h"
+
+#define MAX_STREAMS 16
+#define STATS_INTERVAL_S 5.0
+
+struct Stream {
+    char group[64];           // Multicast group, or "" for plain unicast
+    int sock;
+    // Latest audio, repeated into the mix until the next block lands
+    float block[WIRE_BLOCK_SIZE];
+    bool primed;
+    // Counters, reset each stats interval
+    uint32_t next_seq;
+    bool have_seq;
+    uint64_t received, lost, late;
+    // RFC 3550-style interarrival jitter, in seconds
+    double last_arrival, jitter;
+};
+
+static Stream streams[MAX_STREAMS];
+static int num_streams = 0;
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static int open_stream(Stream *st, const char *group, int port) {
+    st->sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (st->sock < 0) { perror("socket"); return -1; }
+    int one = 1;
+    setsockopt(st->sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    // Bind multicast sockets to the group address itself: membership
+    // filters per-host on Linux, so an INADDR_ANY bind would hand every
+    // joined group's datagrams to every socket — interleaved seqs would
+    // scramble the per-stream counters and blocks. A group-bound socket
+    // only sees its own stream; unicast keeps the wildcard bind.
+    if (group && group[0]) {
+        if (inet_pton(AF_INET, group, &addr.sin_addr) != 1) {
+            fprintf(stderr, "recv: bad group %s\n", group);
+            return -1;
+        }
+    } else {
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+    if (bind(st->sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return -1;
+    }
+
+    if (group && group[0]) {
+        struct ip_mreq mreq;
+        memset(&mreq, 0, sizeof(mreq));
+        memcpy(&mreq.imr_multiaddr, &addr.sin_addr, sizeof(mreq.imr_multiaddr));
+        mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (setsockopt(st->sock, IPPROTO_IP, IP_ADD_MEMBERSHIP,
+                       &mreq, sizeof(mreq)) < 0) {
+            perror("IP_ADD_MEMBERSHIP");
+            return -1;
+        }
+        snprintf(st->group, sizeof(st->group), "%s", group);
+    } else {
+        st->group[0] = '\0';
+    }
+    return 0;
+}
+
+// Accepts v1/v2 headers and legacy bare 288-byte datagrams, mirrors the
+// firmware's receiver_task. Returns blocks consumed.
+static int ingest(Stream *st, const uint8_t *data, int len, double arrival) {
+    int hdr_bytes = 0, nblocks;
+    uint32_t seq = 0;
+    bool have_hdr = false;
+
+    if (len == WIRE_PACKET_SIZE) {
+        nblocks = 1;  // Legacy bare block, no sequencing
+    } else {
+        if (len < (int)WIREPROTO_HDR_V1_BYTES) return 0;
+        nblocks = wireproto_parse_hdr((const wireproto_hdr_t *)data, len, &hdr_bytes);
+        if (nblocks == 0) return 0;
+        memcpy(&seq, data + 4, 4);  // Same offset in v1 and v2
+        have_hdr = true;
+    }
+
+    if (have_hdr) {
+        if (st->have_seq) {
+            int32_t d = (int32_t)(seq - st->next_seq);
+            if (d > 0) st->lost += (uint32_t)d;
+            else if (d < 0) { st->late++; return 0; }  // Reordered duplicate of counted loss
+            st->next_seq = seq + 1;
+        } else {
+            st->have_seq = true;
+            st->next_seq = seq + 1;
+        }
+    }
+    st->received++;
+
+    // Interarrival jitter against the nominal datagram spacing
+    double spacing = (double)(nblocks * WIRE_BLOCK_SIZE) / WIRE_SAMPLE_RATE;
+    if (st->last_arrival > 0.0) {
+        double dev = fabs((arrival - st->last_arrival) - spacing);
+        st->jitter += (dev - st->jitter) / 16.0;  // RFC 3550 smoothing
+    }
+    st->last_arrival = arrival;
+
+    // Keep only the newest block for the mix; batch-convert in one pass
+    audiofmt_unpack_l24be(data + hdr_bytes + (nblocks - 1) * WIRE_PACKET_SIZE,
+                          WIRE_BLOCK_SIZE, st->block);
+    st->primed = true;
+    return nblocks;
+}
+
+// Mix the latest block of every primed stream and emit one s32le block
+static void emit_mix(bool quiet) {
+    if (quiet) return;
+    float mix[WIRE_BLOCK_SIZE] = {0};
+    for (int s = 0; s < num_streams; s++) {
+        if (!streams[s].primed) continue;
+        for (int i = 0; i < WIRE_BLOCK_SIZE; i++) {
+            mix[i] += streams[s].block[i];
+        }
+    }
+    int32_t out[WIRE_BLOCK_SIZE];
+    for (int i = 0; i < WIRE_BLOCK_SIZE; i++) {
+        float v = mix[i];
+        if (v > 1.0f) v = 1.0f;
+        if (v < -1.0f) v = -1.0f;
+        out[i] = (int32_t)(v * 2147483392.0f);  // Headroom for the 24-bit source
+    }
+    fwrite(out, sizeof(out), 1, stdout);
+}
+
+static void print_stats(void) {
+    for (int s = 0; s < num_streams; s++) {
+        Stream *st = &streams[s];
+        fprintf(stderr, "recv[%d] %-15s rx %llu lost %llu late %llu jitter %.2f ms\n",
+                s, st->group[0] ? st->group : "(unicast)",
+                (unsigned long long)st->received, (unsigned long long)st->lost,
+                (unsigned long long)st->late, st->jitter * 1000.0);
+        st->received = st->lost = st->late = 0;
+    }
+}
+
+int main(int argc, char **argv) {
+    int port = WIRE_AUDIO_PORT;
+    bool quiet = false;
+    int argi = 1;
+    for (; argi < argc; argi++) {
+        if (strcmp(argv[argi], "-p") == 0 && argi + 1 < argc) port = atoi(argv[++argi]);
+        else if (strcmp(argv[argi], "-q") == 0) quiet = true;
+        else break;
+    }
+    if (argi >= argc) {
+        fprintf(stderr,
+                "usage: recv [-p port] [-q] <group> [group ...]\n"
+                "  Joins each multicast group (same port), mixes the streams and\n"
+                "  writes s32le mono on stdout; counters on stderr every %.0fs.\n"
+                "  -q suppresses audio output (counters only).\n",
+                STATS_INTERVAL_S);
+        return 1;
+    }
+
+    for (; argi < argc && num_streams < MAX_STREAMS; argi++) {
+        if (open_stream(&streams[num_streams], argv[argi], port) < 0) return 1;
+        num_streams++;
+    }
+    fprintf(stderr, "recv: %d stream(s) on port %d\n", num_streams, port);
+
+    struct pollfd fds[MAX_STREAMS];
+    for (int s = 0; s < num_streams; s++) {
+        fds[s].fd = streams[s].sock;
+        fds[s].events = POLLIN;
+    }
+
+    uint8_t datagram[sizeof(wireproto_hdr_t) + WIREPROTO_MAX_BLOCKS * WIRE_PACKET_SIZE];
+    double next_stats = now_s() + STATS_INTERVAL_S;
+
+    while (1) {
+        if (poll(fds, (nfds_t)num_streams, 1000) < 0) { perror("poll"); return 1; }
+        double arrival = now_s();
+        for (int s = 0; s < num_streams; s++) {
+            if (!(fds[s].revents & POLLIN)) continue;
+            ssize_t len;
+            while ((len = recv(streams[s].sock, datagram, sizeof(datagram),
+                               MSG_DONTWAIT)) > 0) {
+                int nblocks = ingest(&streams[s], datagram, (int)len, arrival);
+                // Stream 0 paces the mix: one output block per clock block
+                if (s == 0) {
+                    for (int b = 0; b < nblocks; b++) emit_mix(quiet);
+                }
+            }
+        }
+        if (arrival >= next_stats) {
+            print_stats();
+            next_stats += STATS_INTERVAL_S;
+        }
+    }
+    return 0;
+}